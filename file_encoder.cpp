@@ -4,7 +4,16 @@
 #include "schifra/schifra_galois_field.hpp"
 #include "schifra/schifra_sequential_root_generator_polynomial_creator.hpp"
 #include "schifra/schifra_reed_solomon_encoder.hpp"
+
+/*
+   Define SCHIFRA_USE_IO_URING to build against the io_uring backend
+   (Linux only), which keeps several parts in flight at once.
+*/
+#if defined(SCHIFRA_USE_IO_URING)
+#include "schifra/schifra_reed_solomon_uring_file_encoder.hpp"
+#else
 #include "schifra/schifra_reed_solomon_file_encoder.hpp"
+#endif
 
 int main()
 {
@@ -18,7 +27,11 @@ int main()
    const std::string output_file_name    = "encoded_file.txt";
 
    typedef schifra::reed_solomon::encoder<code_length,fec_length> encoder_t;
+#if defined(SCHIFRA_USE_IO_URING)
+   typedef schifra::reed_solomon::uring_file_encoder<part_size_bytes,code_length,fec_length> file_encoder_t;
+#else
    typedef schifra::reed_solomon::file_encoder<part_size_bytes,code_length,fec_length> file_encoder_t;
+#endif
 
    const schifra::galois::field field(field_descriptor,
                                       schifra::galois::primitive_polynomial_size06,
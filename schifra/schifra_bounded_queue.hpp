@@ -0,0 +1,124 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_BOUNDED_QUEUE_HPP
+#define INCLUDE_SCHIFRA_BOUNDED_QUEUE_HPP
+
+
+#include <cstddef>
+#include <deque>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+
+namespace schifra
+{
+
+   namespace utils
+   {
+
+      /*
+         Blocking FIFO of fixed capacity used to connect the stages of the
+         threaded file codecs. A producer pushing into a full queue waits
+         until a consumer makes room, which is what bounds the memory held
+         in flight. Once closed, pushes are refused and pops drain whatever
+         remains before reporting the end of the stream.
+      */
+      template <typename T>
+      class bounded_queue
+      {
+      public:
+
+         explicit bounded_queue(const std::size_t capacity)
+         : capacity_((capacity > 0) ? capacity : 1),
+           closed_(false)
+         {}
+
+         inline bool push(const T& value)
+         {
+            boost::mutex::scoped_lock lock(mutex_);
+
+            while (!closed_ && (queue_.size() >= capacity_))
+            {
+               not_full_.wait(lock);
+            }
+
+            if (closed_)
+               return false;
+
+            queue_.push_back(value);
+            not_empty_.notify_one();
+
+            return true;
+         }
+
+         inline bool pop(T& value)
+         {
+            boost::mutex::scoped_lock lock(mutex_);
+
+            while (!closed_ && queue_.empty())
+            {
+               not_empty_.wait(lock);
+            }
+
+            if (queue_.empty())
+               return false;
+
+            value = queue_.front();
+            queue_.pop_front();
+            not_full_.notify_one();
+
+            return true;
+         }
+
+         inline void close()
+         {
+            boost::mutex::scoped_lock lock(mutex_);
+            closed_ = true;
+            not_empty_.notify_all();
+            not_full_.notify_all();
+         }
+
+         inline std::size_t capacity() const
+         {
+            return capacity_;
+         }
+
+      private:
+
+         bounded_queue(const bounded_queue&);
+         bounded_queue& operator=(const bounded_queue&);
+
+         const std::size_t capacity_;
+         bool closed_;
+         std::deque<T> queue_;
+         boost::mutex mutex_;
+         boost::condition_variable not_empty_;
+         boost::condition_variable not_full_;
+      };
+
+   } // namespace utils
+
+} // namespace schifra
+
+#endif
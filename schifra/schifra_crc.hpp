@@ -24,10 +24,18 @@
 #define INCLUDE_SCHIFRA_CRC_HPP
 
 
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <string>
 
 
+#if !defined(NO_CRCSIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+   #define SCHIFRA_CRCSIMD_X86
+   #include <nmmintrin.h>
+#endif
+
+
 namespace schifra
 {
 
@@ -52,7 +60,7 @@ namespace schifra
 
       void update_1byte(const unsigned char data)
       {
-         state = (state >> 8) ^ table[data];
+         state = (state >> 8) ^ table[(state ^ data) & 0xFF];
       }
 
       void update(const unsigned char data[], const std::size_t& count)
@@ -98,7 +106,7 @@ namespace schifra
 
       void initialize_crc32_table()
       {
-         for (std::size_t i = 0; i < 0xFF; ++i)
+         for (std::size_t i = 0; i < 0x100; ++i)
          {
             crc32_t reg = i;
 
@@ -166,6 +174,304 @@ namespace schifra
 
    };
 
+   namespace details
+   {
+      /*
+         CRC-32C (Castagnoli, reflected polynomial 0x82F63B78). The
+         portable path is slicing-by-8 over tables shared by all
+         instances, on x86 the SSE4.2 crc32 instruction is used when the
+         processor supports it. Both operate on the raw register, without
+         the initial and final inversion.
+      */
+      enum { crc32c_polynomial = 0x82F63B78 };
+
+      struct crc32c_table
+      {
+         crc32c_table()
+         {
+            for (unsigned int i = 0; i < 0x100; ++i)
+            {
+               unsigned int reg = i;
+
+               for (int j = 0; j < 0x08; ++j)
+               {
+                  reg = ((reg & 1) ? (reg >> 1) ^ crc32c_polynomial : reg >> 1);
+               }
+
+               slice[0][i] = reg;
+            }
+
+            for (unsigned int i = 0; i < 0x100; ++i)
+            {
+               for (std::size_t k = 1; k < 8; ++k)
+               {
+                  slice[k][i] = (slice[k - 1][i] >> 8) ^ slice[0][slice[k - 1][i] & 0xFF];
+               }
+            }
+         }
+
+         unsigned int slice[8][256];
+      };
+
+      inline const crc32c_table& crc32c_tables()
+      {
+         static const crc32c_table table;
+         return table;
+      }
+
+      inline unsigned int load_le32(const unsigned char* data)
+      {
+         return (static_cast<unsigned int>(data[0])      ) |
+                (static_cast<unsigned int>(data[1]) <<  8) |
+                (static_cast<unsigned int>(data[2]) << 16) |
+                (static_cast<unsigned int>(data[3]) << 24) ;
+      }
+
+      inline unsigned int crc32c_slicing8(unsigned int crc, const unsigned char* data, std::size_t length)
+      {
+         const crc32c_table& table = crc32c_tables();
+
+         while (length >= 8)
+         {
+            const unsigned int lo = crc ^ load_le32(data);
+            const unsigned int hi = load_le32(data + 4);
+
+            crc = table.slice[7][(lo      ) & 0xFF] ^ table.slice[6][(lo >>  8) & 0xFF] ^
+                  table.slice[5][(lo >> 16) & 0xFF] ^ table.slice[4][(lo >> 24)       ] ^
+                  table.slice[3][(hi      ) & 0xFF] ^ table.slice[2][(hi >>  8) & 0xFF] ^
+                  table.slice[1][(hi >> 16) & 0xFF] ^ table.slice[0][(hi >> 24)       ] ;
+
+            data   += 8;
+            length -= 8;
+         }
+
+         while (length-- > 0)
+         {
+            crc = (crc >> 8) ^ table.slice[0][(crc ^ *data++) & 0xFF];
+         }
+
+         return crc;
+      }
+
+      /*
+         Product of a(x) and b(x) modulo the CRC polynomial, in the bit
+         reflected representation where the MSB holds x^0.
+      */
+      inline unsigned int crc32c_multiply(unsigned int a, unsigned int b)
+      {
+         unsigned int product = 0;
+
+         for (unsigned int m = 0x80000000; m != 0; m >>= 1)
+         {
+            if (a & m)
+            {
+               product ^= b;
+            }
+
+            b = (b & 1) ? ((b >> 1) ^ crc32c_polynomial) : (b >> 1);
+         }
+
+         return product;
+      }
+
+      /*
+         x^(8 * length) modulo the CRC polynomial, the operator that runs
+         a CRC register over length zero bytes.
+      */
+      inline unsigned int crc32c_shift(std::size_t length)
+      {
+         unsigned int power  = 0x80000000;       /* x^0         */
+         unsigned int square = 0x00800000;       /* x^8, 1 byte */
+
+         while (length > 0)
+         {
+            if (length & 1)
+            {
+               power = crc32c_multiply(power,square);
+            }
+
+            square = crc32c_multiply(square,square);
+            length >>= 1;
+         }
+
+         return power;
+      }
+
+      #ifdef SCHIFRA_CRCSIMD_X86
+
+      __attribute__((target("sse4.2")))
+      inline unsigned int crc32c_sse42_run(unsigned int crc, const unsigned char* data, std::size_t length)
+      {
+         #if defined(__x86_64__)
+         unsigned long long crc64 = crc;
+
+         for ( ; length >= 8; data += 8, length -= 8)
+         {
+            unsigned long long value;
+            std::memcpy(&value, data, 8);
+            crc64 = _mm_crc32_u64(crc64, value);
+         }
+
+         crc = static_cast<unsigned int>(crc64);
+         #endif
+
+         for ( ; length >= 4; data += 4, length -= 4)
+         {
+            unsigned int value;
+            std::memcpy(&value, data, 4);
+            crc = _mm_crc32_u32(crc, value);
+         }
+
+         while (length-- > 0)
+         {
+            crc = _mm_crc32_u8(crc, *data++);
+         }
+
+         return crc;
+      }
+
+      /*
+         The crc32 instruction has a latency of several cycles but can
+         issue every cycle, so large buffers are processed as three
+         independent streams over adjacent thirds of each block, which
+         are merged by shifting the earlier registers over the bytes
+         that follow them.
+      */
+      __attribute__((target("sse4.2")))
+      inline unsigned int crc32c_sse42(unsigned int crc, const unsigned char* data, std::size_t length)
+      {
+         #if defined(__x86_64__)
+         const std::size_t stream_length = 4096;
+
+         if (length >= (3 * stream_length))
+         {
+            const unsigned int shift = crc32c_shift(stream_length);
+
+            do
+            {
+               unsigned long long crc0 = crc;
+               unsigned long long crc1 = 0;
+               unsigned long long crc2 = 0;
+
+               for (std::size_t i = 0; i < stream_length; i += 8)
+               {
+                  unsigned long long value0;
+                  unsigned long long value1;
+                  unsigned long long value2;
+
+                  std::memcpy(&value0, data + i                      , 8);
+                  std::memcpy(&value1, data + i +      stream_length , 8);
+                  std::memcpy(&value2, data + i + (2 * stream_length), 8);
+
+                  crc0 = _mm_crc32_u64(crc0, value0);
+                  crc1 = _mm_crc32_u64(crc1, value1);
+                  crc2 = _mm_crc32_u64(crc2, value2);
+               }
+
+               crc = crc32c_multiply(shift, crc32c_multiply(shift, static_cast<unsigned int>(crc0)) ^
+                                            static_cast<unsigned int>(crc1)) ^
+                     static_cast<unsigned int>(crc2);
+
+               data   += 3 * stream_length;
+               length -= 3 * stream_length;
+            }
+            while (length >= (3 * stream_length));
+         }
+         #endif
+
+         return crc32c_sse42_run(crc, data, length);
+      }
+
+      #endif
+
+      typedef unsigned int (*crc32c_function)(unsigned int, const unsigned char*, std::size_t);
+
+      inline crc32c_function select_crc32c_function()
+      {
+         #ifdef SCHIFRA_CRCSIMD_X86
+         __builtin_cpu_init();
+
+         if (__builtin_cpu_supports("sse4.2"))
+            return crc32c_sse42;
+         #endif
+
+         return crc32c_slicing8;
+      }
+
+      inline crc32c_function crc32c_update_function()
+      {
+         static const crc32c_function function = select_crc32c_function();
+         return function;
+      }
+
+   } // namespace details
+
+   /*
+      CRC-32C as used by iSCSI, ext4 and SCTP. Unlike crc32 the
+      polynomial is fixed, which allows the lookup tables to be shared
+      and the hardware instruction to be used where available. CRCs of
+      adjacent pieces of data computed independently, for instance by
+      different threads, can be merged with combine.
+   */
+   class crc32c
+   {
+   public:
+
+      typedef unsigned int crc32c_t;
+
+      crc32c()
+      : state_(0xFFFFFFFF),
+        update_(details::crc32c_update_function())
+      {}
+
+      void reset()
+      {
+         state_ = 0xFFFFFFFF;
+      }
+
+      void update(const unsigned char data[], const std::size_t& count)
+      {
+         state_ = update_(state_, data, count);
+      }
+
+      void update(const char data[], const std::size_t& count)
+      {
+         state_ = update_(state_, reinterpret_cast<const unsigned char*>(data), count);
+      }
+
+      void update(const std::string& data)
+      {
+         state_ = update_(state_, reinterpret_cast<const unsigned char*>(data.data()), data.size());
+      }
+
+      crc32c_t crc() const
+      {
+         return state_ ^ 0xFFFFFFFF;
+      }
+
+      /* CRC of the concatenation of two pieces given the CRC of each. */
+      static inline crc32c_t combine(const crc32c_t crc1, const crc32c_t crc2, const std::size_t length2)
+      {
+         return details::crc32c_multiply(details::crc32c_shift(length2), crc1) ^ crc2;
+      }
+
+      static inline crc32c_t compute(const unsigned char data[], const std::size_t count)
+      {
+         return details::crc32c_update_function()(0xFFFFFFFF, data, count) ^ 0xFFFFFFFF;
+      }
+
+      /* True when the SSE4.2 crc32 instruction is in use. */
+      static inline bool hardware_accelerated()
+      {
+         return (details::crc32c_update_function() != details::crc32c_slicing8);
+      }
+
+   private:
+
+      crc32c_t state_;
+      details::crc32c_function update_;
+   };
+
 } // namespace schifra
 
 
@@ -41,12 +41,29 @@ namespace schifra
       template <> struct symbol<  511>  { enum {size =  9}; };
       template <> struct symbol< 1023>  { enum {size = 10}; };
       template <> struct symbol< 2047>  { enum {size = 11}; };
-      template <> struct symbol< 4195>  { enum {size = 12}; };
+      template <> struct symbol< 4095>  { enum {size = 12}; };
       template <> struct symbol< 8191>  { enum {size = 13}; };
       template <> struct symbol<16383>  { enum {size = 14}; };
-      template <> struct symbol<32768>  { enum {size = 15}; };
+      template <> struct symbol<32767>  { enum {size = 15}; };
       template <> struct symbol<65535>  { enum {size = 16}; };
 
+      /*
+         Narrowest unsigned type able to hold a symbol of the given
+         code, used for the symbols of blocks and by the table driven
+         codec paths. A code_length of the form 2^m - 1 is taken to be a
+         full length code over GF(2^m), any other length being that of
+         a shortened code, whose field is not known here and which is
+         given room for symbols of up to 16 bits.
+      */
+      template <bool byte_sized> struct symbol_storage_selector        { typedef unsigned short type; };
+      template <>                struct symbol_storage_selector<true>  { typedef unsigned char  type; };
+
+      template <std::size_t code_length>
+      struct symbol_storage
+      {
+         typedef typename symbol_storage_selector<((code_length & (code_length + 1)) == 0) && (code_length <= 255)>::type type;
+      };
+
       /* Credits: Modern C++ Design - Andrei Alexandrescu */
       template <bool> class __static_assert__
       {
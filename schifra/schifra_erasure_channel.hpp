@@ -24,6 +24,8 @@
 #define INCLUDE_SCHIFRA_ERASURE_CHANNEL_HPP
 
 
+#include <vector>
+
 #include "schifra_reed_solomon_block.hpp"
 #include "schifra_reed_solomon_encoder.hpp"
 #include "schifra_reed_solomon_decoder.hpp"
@@ -61,6 +63,48 @@ namespace schifra
       inline bool erasure_channel_stack_encode(const encoder<code_length,fec_length>& encoder,
                                                      block<code_length,fec_length> (&output)[code_length])
       {
+         if (encoder.supports_interleaved())
+         {
+            /*
+               Encode the whole stack column-wise, the resulting columns
+               are the rows of the interleaved stack.
+            */
+            const std::size_t data_length = code_length - fec_length;
+
+            std::vector<unsigned char> stack(code_length * code_length);
+            unsigned char* column[code_length];
+
+            for (std::size_t i = 0; i < code_length; ++i)
+            {
+               column[i] = &stack[i * code_length];
+            }
+
+            for (std::size_t row = 0; row < code_length; ++row)
+            {
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  column[i][row] = static_cast<unsigned char>(output[row][i] & 0xFF);
+               }
+            }
+
+            if (!encoder.encode_interleaved(column, code_length))
+            {
+               std::cout << "erasure_channel_stack_encode() - Error: Failed to encode stack" << std::endl;
+
+               return false;
+            }
+
+            for (std::size_t i = 0; i < code_length; ++i)
+            {
+               for (std::size_t row = 0; row < code_length; ++row)
+               {
+                  output[i][row] = column[i][row];
+               }
+            }
+
+            return true;
+         }
+
          for (std::size_t i = 0; i < code_length; ++i)
          {
             if (!encoder.encode(output[i]))
@@ -91,7 +135,6 @@ namespace schifra
          {
             for (std::size_t i = 0; i < code_length; ++i)
             {
-               received_.push_back(galois::field_polynomial(decoder_type::field_, code_length - 1));
                syndrome_.push_back(galois::field_polynomial(decoder_type::field_));
             }
          };
@@ -108,8 +151,7 @@ namespace schifra
 
             for (std::size_t i = 0; i < code_length; ++i)
             {
-               decoder_type::load_message    (received_[i], rsblock  [i]);
-               decoder_type::compute_syndrome(received_[i], syndrome_[i]);
+               decoder_type::compute_syndrome(rsblock[i], syndrome_[i]);
             }
 
             erasure_locations_t erasure_locations;
@@ -158,6 +200,91 @@ namespace schifra
             return true;
          }
 
+         /*
+            Erasure decode row_count codewords held column-wise, such that
+            column[i][r] is symbol i of codeword r. As every codeword has
+            the same erasures, the correction at each erased location is
+            a fixed linear combination of a codeword's syndromes. Hence
+            the syndromes are computed for all codewords at once, and each
+            erased column is then rebuilt with fec_length region
+            multiply-accumulates.
+         */
+         bool decode_interleaved(unsigned char* const column[],
+                                 const std::size_t row_count,
+                                 const erasure_locations_t& erasure_list) const
+         {
+            if (
+                 (!decoder_type::supports_interleaved()) ||
+                 (erasure_list.size() != fec_length)
+               )
+            {
+               return false;
+            }
+
+            std::vector<unsigned char> syndrome_buffer(fec_length * row_count);
+            unsigned char* syndrome[fec_length];
+
+            for (std::size_t k = 0; k < fec_length; ++k)
+            {
+               syndrome[k] = &syndrome_buffer[k * row_count];
+            }
+
+            if (!decoder_type::compute_syndromes_interleaved(column, row_count, syndrome))
+            {
+               return true;
+            }
+
+            erasure_locations_t erasure_locations;
+            decoder_type::prepare_erasure_list(erasure_locations,erasure_list);
+
+            galois::field_polynomial gamma(galois::field_element(decoder_type::field_, 1));
+
+            decoder_type::compute_gamma(gamma,erasure_locations);
+
+            std::vector<int> gamma_roots;
+
+            find_roots_in_data(gamma,gamma_roots);
+
+            const galois::field_polynomial gamma_derivative = gamma.derivative();
+            const galois::field&           field            = decoder_type::field_;
+
+            for (std::size_t i = 0; i < gamma_roots.size(); ++i)
+            {
+               const int                  error_location = gamma_roots[i];
+               const galois::field_symbol alpha_inverse  = field.alpha(error_location);
+               const galois::field_symbol denominator    = gamma_derivative(alpha_inverse).poly();
+
+               if (0 == denominator)
+               {
+                  return false;
+               }
+
+               const galois::field_symbol scale = field.div(decoder_type::root_exponent_table_[error_location], denominator);
+
+               /*
+                  omega(x) = (gamma(x) * S(x)) mod x^fec_length, hence the
+                  coefficient of syndrome u in omega(alpha_inverse) is the
+                  sum over t in [u,fec_length) of gamma[t - u] * alpha_inverse^t
+               */
+               for (std::size_t u = 0; u < fec_length; ++u)
+               {
+                  galois::field_symbol coefficient = 0;
+
+                  for (std::size_t t = u; t < fec_length; ++t)
+                  {
+                     if (static_cast<int>(t - u) > gamma.deg())
+                        break;
+
+                     coefficient ^= field.mul(gamma[t - u].poly(), field.exp(alpha_inverse, static_cast<int>(t)));
+                  }
+
+                  decoder_type::region_.mul_add(field.mul(coefficient, scale), syndrome[u], column[error_location - 1], row_count);
+               }
+            }
+
+            return true;
+         }
+
       private:
 
          void find_roots_in_data(const galois::field_polynomial& poly, std::vector<int>& root_list) const
@@ -187,7 +314,6 @@ namespace schifra
             }
          }
 
-         mutable polynomial_list_type received_;
          mutable polynomial_list_type syndrome_;
 
       };
@@ -237,6 +363,42 @@ namespace schifra
          }
          else if (missing_row_index.size() == fec_length)
          {
+            if (erasure_decoder.supports_interleaved())
+            {
+               /*
+                  Prior to being interleaved, output[i][j] is symbol i of
+                  codeword j - which is the column-wise layout the batch
+                  decoder operates upon.
+               */
+               std::vector<unsigned char> stack(code_length * code_length);
+               unsigned char* column[code_length];
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  column[i] = &stack[i * code_length];
+
+                  for (std::size_t j = 0; j < code_length; ++j)
+                  {
+                     column[i][j] = static_cast<unsigned char>(output[i][j] & 0xFF);
+                  }
+               }
+
+               if (!erasure_decoder.decode_interleaved(column, code_length, missing_row_index))
+               {
+                  return false;
+               }
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  for (std::size_t j = 0; j < code_length; ++j)
+                  {
+                     output[j][i] = column[i][j];
+                  }
+               }
+
+               return true;
+            }
+
             interleave<code_length,fec_length>(output);
 
             return erasure_decoder.decode(output,missing_row_index);
@@ -220,6 +220,25 @@ namespace schifra
          return crc_module.crc();
       }
 
+      inline crc32c::crc32c_t file_crc(crc32c& crc_module, const std::string& file_name)
+      {
+         std::ifstream file(file_name.c_str(),std::ios::binary);
+         if (!file) return 0;
+
+         const std::size_t block_size = 1048576;
+         std::vector<char> buffer(block_size);
+
+         crc_module.reset();
+
+         while (file)
+         {
+            file.read(&buffer[0],static_cast<std::streamsize>(block_size));
+            crc_module.update(&buffer[0],static_cast<std::size_t>(file.gcount()));
+         }
+
+         return crc_module.crc();
+      }
+
    } // namespace fileio
 
 } // namespace schifra
@@ -40,6 +40,225 @@ namespace schifra
       typedef int          field_symbol;
       const   field_symbol GFERROR = -1;
 
+      /*
+         Fields up to GF(2^SCHIFRA_GFLUT_MAX_POWER) precompute complete
+         multiplication, division and exponentiation tables, whose size
+         grows with the square of the field size. Larger fields keep only
+         their log and anti-log tables, the anti-log table being of twice
+         the field size so that a sum of two logs needs no reduction.
+         Defining NO_GFLUT makes every field take the latter form.
+      */
+      #if !defined(SCHIFRA_GFLUT_MAX_POWER)
+         #define SCHIFRA_GFLUT_MAX_POWER 8
+      #endif
+
+      /*
+         Element type of the precomputed tables, as narrow as the largest
+         field they are built for allows, which for GF(2^8) keeps each of
+         them at 64KB rather than 256KB.
+      */
+      #if (SCHIFRA_GFLUT_MAX_POWER <= 8)
+         typedef unsigned char  lut_symbol;
+      #else
+         typedef unsigned short lut_symbol;
+      #endif
+
+      namespace details
+      {
+
+         /* Degree of a polynomial given as a bit mask. */
+         template <unsigned int polynomial>
+         struct static_degree
+         {
+            enum { value = 1 + static_degree<(polynomial >> 1)>::value };
+         };
+
+         template <>
+         struct static_degree<1>
+         {
+            enum { value = 0 };
+         };
+
+         /*
+            alpha^i in GF(2^power), primitive_polynomial being given as
+            a bit mask with bit k set for the term x^k, x^power included.
+         */
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int i>
+         struct static_alpha
+         {
+            enum { previous = static_alpha<power,primitive_polynomial,i - 1>::value };
+            enum { value    = (previous << 1) ^ (((previous >> (power - 1)) & 1) ? primitive_polynomial : 0) };
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial>
+         struct static_alpha<power,primitive_polynomial,0>
+         {
+            enum { value = 1 };
+         };
+
+         /*
+            Linear search for the log of v, stopping at the field size
+            for symbols that are not a power of alpha (zero and values
+            beyond the field).
+         */
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v, unsigned int i,
+                   bool found = ((i >= ((1U << power) - 1)) ||
+                                 (static_cast<unsigned int>(static_alpha<power,primitive_polynomial,i>::value) == v))>
+         struct static_log_search
+         {
+            enum { value = static_log_search<power,primitive_polynomial,v,i + 1>::value };
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v, unsigned int i>
+         struct static_log_search<power,primitive_polynomial,v,i,true>
+         {
+            enum { value = i };
+         };
+
+         /*
+            The search costs the compiler a quadratic number of template
+            instances per field, so the built-in polynomials specialise
+            static_log below with the log of each alpha^i directly.
+         */
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v>
+         struct static_log
+         {
+            enum { value = static_log_search<power,primitive_polynomial,v,0>::value };
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v>
+         struct static_in_field
+         {
+            enum { value = (0 != v) && (v < (1U << power)) };
+         };
+
+         /*
+            Key of the i-th specialisation of static_log for a field:
+            alpha^i within the field, and past every symbol beyond it,
+            so that the keys remain distinct.
+         */
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int i>
+         struct static_log_key
+         {
+            enum { field_size = (1U << power) - 1 };
+            enum { value = (i < field_size) ? static_cast<unsigned int>(static_alpha<power,primitive_polynomial,(i % field_size)>::value) : (256 + i) };
+         };
+
+         /* Entries of the tables of field, see static_field_tables. */
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int i>
+         struct static_alpha_entry
+         {
+            enum { field_size = (1U << power) - 1 };
+            enum { value = (i < (2 * (field_size + 1))) ? static_alpha<power,primitive_polynomial,(i % field_size)>::value : 0 };
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v, bool in_field = static_in_field<power,primitive_polynomial,v>::value>
+         struct static_index_entry
+         {
+            enum { value = static_log<power,primitive_polynomial,v>::value };
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v>
+         struct static_index_entry<power,primitive_polynomial,v,false>
+         {
+            enum { value = (0 == v) ? GFERROR : 0 };
+         };
+
+         /*
+            Anti-log and log tables of GF(2^power) laid out as field keeps
+            them, of twice the field size and with GFERROR as the log of
+            zero, built by the compiler into read-only data.
+         */
+         template <unsigned int power, unsigned int primitive_polynomial>
+         struct static_field_tables
+         {
+            static const field_symbol alpha_to[2 * 256];
+            static const field_symbol index_of[256];
+         };
+
+         /*
+            The tables are spelt out as 256 entry initializers by the macros
+            below, the value of each entry being evaluated by the compiler.
+            The repeat macros are shared with schifra_galois_static_field.hpp.
+         */
+         #define schifra_static_field_repeat16(F,X,b)              \
+            F(X,(b) +  0) F(X,(b) +  1) F(X,(b) +  2) F(X,(b) +  3) \
+            F(X,(b) +  4) F(X,(b) +  5) F(X,(b) +  6) F(X,(b) +  7) \
+            F(X,(b) +  8) F(X,(b) +  9) F(X,(b) + 10) F(X,(b) + 11) \
+            F(X,(b) + 12) F(X,(b) + 13) F(X,(b) + 14) F(X,(b) + 15) \
+
+         #define schifra_static_field_repeat256(F,X)                                     \
+            schifra_static_field_repeat16(F,X,  0) schifra_static_field_repeat16(F,X, 16) \
+            schifra_static_field_repeat16(F,X, 32) schifra_static_field_repeat16(F,X, 48) \
+            schifra_static_field_repeat16(F,X, 64) schifra_static_field_repeat16(F,X, 80) \
+            schifra_static_field_repeat16(F,X, 96) schifra_static_field_repeat16(F,X,112) \
+            schifra_static_field_repeat16(F,X,128) schifra_static_field_repeat16(F,X,144) \
+            schifra_static_field_repeat16(F,X,160) schifra_static_field_repeat16(F,X,176) \
+            schifra_static_field_repeat16(F,X,192) schifra_static_field_repeat16(F,X,208) \
+            schifra_static_field_repeat16(F,X,224) schifra_static_field_repeat16(F,X,240) \
+
+         #define schifra_static_field_log(polynomial,i)                                                                         \
+            template <> struct static_log<static_degree<polynomial>::value,polynomial,                                         \
+                                          static_log_key<static_degree<polynomial>::value,polynomial,(i)>::value>             \
+            { enum { value = (i) }; };                                                                                         \
+
+         /* Direct logs of the built-in polynomials of degree 8. */
+         schifra_static_field_repeat256(schifra_static_field_log,0x11D)
+         schifra_static_field_repeat256(schifra_static_field_log,0x187)
+
+         #undef schifra_static_field_log
+
+         #define schifra_static_field_alpha(offset,i) \
+            static_alpha_entry<power,primitive_polynomial,(offset) + (i)>::value,
+
+         #define schifra_static_field_index(unused,i) \
+            static_index_entry<power,primitive_polynomial,i>::value,
+
+         template <unsigned int power, unsigned int primitive_polynomial>
+         const field_symbol static_field_tables<power,primitive_polynomial>::alpha_to[2 * 256] =
+         {
+            schifra_static_field_repeat256(schifra_static_field_alpha,  0)
+            schifra_static_field_repeat256(schifra_static_field_alpha,256)
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial>
+         const field_symbol static_field_tables<power,primitive_polynomial>::index_of[256] =
+         {
+            schifra_static_field_repeat256(schifra_static_field_index,0)
+         };
+
+         #undef schifra_static_field_alpha
+         #undef schifra_static_field_index
+
+         /*
+            Point alpha_to and index_of at the compiler built tables of
+            the field when its primitive polynomial, as a bit mask, is
+            primitive_polynomial05 or primitive_polynomial06. Other fields
+            of up to 2^8 elements build theirs in a few microseconds.
+         */
+         inline bool select_static_field_tables(const unsigned int power,
+                                                const unsigned int polynomial,
+                                                const field_symbol*& alpha_to,
+                                                const field_symbol*& index_of)
+         {
+            #define schifra_static_field_case(degree,mask)                       \
+            case mask : if (degree != power) return false;                      \
+                        alpha_to = static_field_tables<degree,mask>::alpha_to; \
+                        index_of = static_field_tables<degree,mask>::index_of; \
+                        return true;                                           \
+
+            switch (polynomial)
+            {
+               schifra_static_field_case(8,0x11D)
+               schifra_static_field_case(8,0x187)
+               default : return false;
+            }
+
+            #undef schifra_static_field_case
+         }
+
+      } // namespace details
+
       class field
       {
       public:
@@ -104,67 +323,58 @@ namespace schifra
          inline field_symbol mul(const field_symbol& a, const field_symbol& b) const
          {
             #if !defined(NO_GFLUT)
-               return mul_table_[a][b];
-            #else
-               if ((a == 0) || (b == 0))
-                  return 0;
-               else
-                  return alpha_to_[normalize(index_of_[a] + index_of_[b])];
+               if (0 != mul_table_)
+                  return mul_table_[(a << power_) + b];
             #endif
+
+            if ((a == 0) || (b == 0))
+               return 0;
+            else
+               return alpha_to_[index_of_[a] + index_of_[b]];
          }
 
          inline field_symbol div(const field_symbol& a, const field_symbol& b) const
          {
             #if !defined(NO_GFLUT)
-               return div_table_[a][b];
-            #else
-               if ((a == 0) || (b == 0))
-                  return 0;
-               else
-                  return alpha_to_[normalize(index_of_[a] - index_of_[b] + field_size_)];
+               if (0 != div_table_)
+                  return div_table_[(a << power_) + b];
             #endif
+
+            if ((a == 0) || (b == 0))
+               return 0;
+            else
+               return alpha_to_[index_of_[a] + static_cast<field_symbol>(field_size_) - index_of_[b]];
          }
 
          inline field_symbol exp(const field_symbol& a, int n) const
          {
             #if !defined(NO_GFLUT)
-               if (n >= 0)
-                  return exp_table_[a][n & field_size_];
+               if (0 == exp_table_)
+                  return compact_exp(a,n);
+               else if (n >= 0)
+                  return exp_table_[(a << power_) + (n & field_size_)];
                else
                {
                   while (n < 0) n += field_size_;
 
-                  return (n ? exp_table_[a][n] : 1);
+                  return (n ? exp_table_[(a << power_) + n] : 1);
                }
             #else
-               if (a != 0)
-               {
-                  if (n < 0)
-                  {
-                     while (n < 0) n += field_size_;
-                     return (n ? alpha_to_[normalize(index_of_[a] * n)] : 1);
-                  }
-                  else if (n)
-                     return alpha_to_[normalize(index_of_[a] * static_cast<field_symbol>(n))];
-                  else
-                     return 1;
-               }
-               else
-                  return 0;
+               return compact_exp(a,n);
             #endif
          }
 
          #ifdef LINEAR_EXP_LUT
-         inline field_symbol* const linear_exp(const field_symbol& a) const
+         inline const lut_symbol* linear_exp(const field_symbol& a) const
          {
             #if !defined(NO_GFLUT)
                static const field_symbol upper_bound = 2 * field_size_;
-               if ((a >= 0) && (a <= upper_bound))
-                  return linear_exp_table_[a];
+               if ((0 != linear_exp_table_) && (a >= 0) && (a <= upper_bound))
+                  return linear_exp_table_ + (a << (power_ + 1));
                else
-                  return reinterpret_cast<field_symbol*>(0);
+                  return reinterpret_cast<lut_symbol*>(0);
             #else
-               return reinterpret_cast<field_symbol*>(0);
+               return reinterpret_cast<lut_symbol*>(0);
             #endif
          }
          #endif
@@ -172,10 +382,23 @@ namespace schifra
          inline field_symbol inverse(const field_symbol& val) const
          {
             #if !defined(NO_GFLUT)
-               return mul_inverse_[val];
-            #else
-               return alpha_to_[normalize(field_size_ - index_of_[val])];
+               if (0 != mul_inverse_)
+                  return mul_inverse_[val];
             #endif
+
+            return alpha_to_[static_cast<field_symbol>(field_size_) - index_of_[val]];
+         }
+
+         /* True when the full multiplication tables are in use. */
+         inline bool lut_enabled() const
+         {
+            return (0 != mul_table_);
+         }
+
+         /* True when the log and anti-log tables are the compiler built ones. */
+         inline bool static_tables() const
+         {
+            return (0 == log_buffer_);
          }
 
          inline unsigned int prim_poly_term(const unsigned int index) const
@@ -192,33 +415,44 @@ namespace schifra
          field& operator=(const field& gfield);
 
          void         generate_field(const unsigned int* prim_poly_);
-         field_symbol gen_mul       (const field_symbol& a, const field_symbol& b) const;
-         field_symbol gen_div       (const field_symbol& a, const field_symbol& b) const;
-         field_symbol gen_exp       (const field_symbol& a, const std::size_t&  n) const;
+         void         generate_lut();
+         inline field_symbol compact_exp(const field_symbol& a, const int n) const
+         {
+            if (a != 0)
+            {
+               const std::size_t order    = field_size_;
+               const std::size_t exponent = (n < 0) ? (order - (static_cast<std::size_t>(-(n + 1)) % order) - 1) :
+                                                      (static_cast<std::size_t>(n) % order);
+
+               if (0 == exponent)
+                  return 1;
+               else
+                  return alpha_to_[(static_cast<std::size_t>(index_of_[a]) * exponent) % order];
+            }
+            else
+               return 0;
+         }
+
          field_symbol gen_inverse   (const field_symbol& val) const;
 
-         std::size_t create_array(char buffer_[],
-                                  const std::size_t& length,
-                                  const std::size_t offset,
-                                  field_symbol** array);
-
-         std::size_t create_2d_array(char buffer_[],
-                                     std::size_t row_cnt, std::size_t col_cnt,
-                                     const std::size_t offset,
-                                     field_symbol*** array);
-         unsigned int   power_;
-         std::size_t    prim_poly_deg_;
-         unsigned int   field_size_;
-         unsigned int   prim_poly_hash_;
-         unsigned int*  prim_poly_;
-         field_symbol*  alpha_to_;    // aka exponential or anti-log
-         field_symbol*  index_of_;    // aka log
-         field_symbol*  mul_inverse_; // multiplicative inverse
-         field_symbol** mul_table_;
-         field_symbol** div_table_;
-         field_symbol** exp_table_;
-         field_symbol** linear_exp_table_;
-         char*          buffer_;
+         /*
+            The precomputed tables are flat, row a of a table of field
+            size + 1 columns starting at a << power.
+         */
+         unsigned int         power_;
+         std::size_t          prim_poly_deg_;
+         unsigned int         field_size_;
+         unsigned int         prim_poly_hash_;
+         unsigned int*        prim_poly_;
+         const field_symbol*  alpha_to_;    // aka exponential or anti-log
+         const field_symbol*  index_of_;    // aka log
+         lut_symbol*          mul_inverse_; // multiplicative inverse
+         lut_symbol*          mul_table_;
+         lut_symbol*          div_table_;
+         lut_symbol*          exp_table_;
+         lut_symbol*          linear_exp_table_;
+         field_symbol*        log_buffer_;
+         lut_symbol*          buffer_;
       };
 
       field::field(const int  pwr, const std::size_t primpoly_deg, const unsigned int* primitive_poly)
@@ -226,52 +460,55 @@ namespace schifra
         prim_poly_deg_(primpoly_deg),
         field_size_((1 << power_) - 1)
       {
-         alpha_to_    = new field_symbol [field_size_ + 1];
-         index_of_    = new field_symbol [field_size_ + 1];
+         alpha_to_         = 0;
+         index_of_         = 0;
+         log_buffer_       = 0;
+         buffer_           = 0;
+         mul_table_        = 0;
+         div_table_        = 0;
+         exp_table_        = 0;
+         mul_inverse_      = 0;
+         linear_exp_table_ = 0;
 
          #if !defined(NO_GFLUT)
 
-         #ifdef LINEAR_EXP_LUT
-         static const std::size_t buffer_size = ((6 * (field_size_ + 1) * (field_size_ + 1)) + ((field_size_ + 1) * 2)) * sizeof(field_symbol);
-         #else
-         static const std::size_t buffer_size = ((4 * (field_size_ + 1) * (field_size_ + 1)) + ((field_size_ + 1) * 2)) * sizeof(field_symbol);
-         #endif
-
-         buffer_ = new char[buffer_size];
-         std::size_t offset = 0;
-         offset = create_2d_array(buffer_,(field_size_ + 1),(field_size_ + 1),offset,&mul_table_);
-         offset = create_2d_array(buffer_,(field_size_ + 1),(field_size_ + 1),offset,&div_table_);
-         offset = create_2d_array(buffer_,(field_size_ + 1),(field_size_ + 1),offset,&exp_table_);
-
-         #ifdef LINEAR_EXP_LUT
-         offset = create_2d_array(buffer_,(field_size_ + 1),(field_size_ + 1) * 2,offset,&linear_exp_table_);
-         #else
-         linear_exp_table_ = 0;
-         #endif
+         if (power_ <= SCHIFRA_GFLUT_MAX_POWER)
+         {
+            const std::size_t table_size = (field_size_ + 1) * (field_size_ + 1);
 
-         offset = create_array(buffer_,(field_size_ + 1) * 2,offset,&mul_inverse_);
+            #ifdef LINEAR_EXP_LUT
+            const std::size_t buffer_size = (5 * table_size) + ((field_size_ + 1) * 2);
+            #else
+            const std::size_t buffer_size = (3 * table_size) + ((field_size_ + 1) * 2);
+            #endif
 
-         #else
+            buffer_      = new lut_symbol[buffer_size];
+            mul_table_   = buffer_;
+            div_table_   = mul_table_ + table_size;
+            exp_table_   = div_table_ + table_size;
+            mul_inverse_ = exp_table_ + table_size;
 
-           buffer_      = 0;
-           mul_table_   = 0;
-           div_table_   = 0;
-           exp_table_   = 0;
-           mul_inverse_ = 0;
-           linear_exp_table_ = 0;
+            #ifdef LINEAR_EXP_LUT
+            linear_exp_table_ = mul_inverse_ + ((field_size_ + 1) * 2);
+            #endif
+         }
 
          #endif
 
-         prim_poly_ = new unsigned int [prim_poly_deg_ + 1];
+         /*
+            Note: primpoly_deg is the number of terms of the primitive
+                  polynomial, being one more than its degree.
+         */
+         prim_poly_ = new unsigned int [prim_poly_deg_];
 
-         for (unsigned int i = 0; i < (prim_poly_deg_ + 1); ++i)
+         for (unsigned int i = 0; i < prim_poly_deg_; ++i)
          {
             prim_poly_[i] = primitive_poly[i];
          }
 
          prim_poly_hash_ = 0xAAAAAAAA;
 
-         for (std::size_t i = 0; i < (prim_poly_deg_ + 1); ++i)
+         for (std::size_t i = 0; i < prim_poly_deg_; ++i)
          {
             prim_poly_hash_ += ((i & 1) == 0) ? (  (prim_poly_hash_ <<  7) ^  primitive_poly[i] * (prim_poly_hash_ >> 3)) :
                                                 (~((prim_poly_hash_ << 11) + (primitive_poly[i] ^ (prim_poly_hash_ >> 5))));
@@ -282,23 +519,9 @@ namespace schifra
 
       field::~field()
       {
-         if (0 !=  alpha_to_) { delete [] alpha_to_;  alpha_to_  = 0; }
-         if (0 !=  index_of_) { delete [] index_of_;  index_of_  = 0; }
-         if (0 != prim_poly_) { delete [] prim_poly_; prim_poly_ = 0; }
-
-         #if !defined(NO_GFLUT)
-
-         if (0 != mul_table_) { delete [] mul_table_; mul_table_ = 0; }
-         if (0 != div_table_) { delete [] div_table_; div_table_ = 0; }
-         if (0 != exp_table_) { delete [] exp_table_; exp_table_ = 0; }
-
-         #ifdef LINEAR_EXP_LUT
-         if (0 != linear_exp_table_) { delete [] linear_exp_table_; linear_exp_table_ = 0; }
-         #endif
-
-         if (0 != buffer_) { delete [] buffer_; buffer_ = 0; }
-
-         #endif
+         if (0 != log_buffer_) { delete [] log_buffer_; log_buffer_ = 0; }
+         if (0 !=  prim_poly_) { delete [] prim_poly_;  prim_poly_  = 0; }
+         if (0 !=     buffer_) { delete [] buffer_;     buffer_     = 0; }
       }
 
       inline bool field::operator==(const field& gf) const
@@ -316,131 +539,153 @@ namespace schifra
 
       inline void field::generate_field(const unsigned int* prim_poly)
       {
+         unsigned int polynomial = 0;
+
+         for (std::size_t i = 0; (i < prim_poly_deg_) && (i < 32); ++i)
+         {
+            if (prim_poly[i] != 0)
+            {
+               polynomial |= (1U << i);
+            }
+         }
+
+         if (details::select_static_field_tables(power_, polynomial, alpha_to_, index_of_))
+         {
+            generate_lut();
+            return;
+         }
+
          /*
             Note: It is assumed that the degree of the primitive
                   polynomial will be equivelent to the m value as
                   in GF(2^m)
          */
 
+         log_buffer_ = new field_symbol [(2 * (field_size_ + 1)) + (field_size_ + 1)];
+
+         field_symbol* alpha_to = log_buffer_;
+         field_symbol* index_of = log_buffer_ + (2 * (field_size_ + 1));
+
          field_symbol mask = 1;
 
-         alpha_to_[power_] = 0;
+         alpha_to[power_] = 0;
 
          for (field_symbol i = 0; i < static_cast<field_symbol>(power_); ++i)
          {
-            alpha_to_[i]            = mask;
-            index_of_[alpha_to_[i]] = i;
+            alpha_to[i]           = mask;
+            index_of[alpha_to[i]] = i;
 
             if (prim_poly[i] != 0)
             {
-               alpha_to_[power_] ^= mask;
+               alpha_to[power_] ^= mask;
             }
 
             mask <<= 1;
          }
 
-         index_of_[alpha_to_[power_]] = power_;
+         index_of[alpha_to[power_]] = power_;
 
          mask >>= 1;
 
          for (field_symbol i = power_ + 1; i < static_cast<field_symbol>(field_size_); ++i)
          {
-            if (alpha_to_[i - 1] >= mask)
-              alpha_to_[i] = alpha_to_[power_] ^ ((alpha_to_[i - 1] ^ mask) << 1);
+            if (alpha_to[i - 1] >= mask)
+              alpha_to[i] = alpha_to[power_] ^ ((alpha_to[i - 1] ^ mask) << 1);
             else
-              alpha_to_[i] = alpha_to_[i - 1] << 1;
+              alpha_to[i] = alpha_to[i - 1] << 1;
 
-            index_of_[alpha_to_[i]] = i;
+            index_of[alpha_to[i]] = i;
          }
 
-         index_of_[0] = GFERROR;
-         alpha_to_[field_size_] = 1;
+         index_of[0] = GFERROR;
+         alpha_to[field_size_] = 1;
 
+         for (std::size_t i = field_size_ + 1; i < (2 * (field_size_ + 1)); ++i)
+         {
+            alpha_to[i] = alpha_to[i - field_size_];
+         }
+
+         alpha_to_ = alpha_to;
+         index_of_ = index_of;
+
+         generate_lut();
+      }
+
+      inline void field::generate_lut()
+      {
          #if !defined(NO_GFLUT)
 
-           for (field_symbol i = 0; i < static_cast<field_symbol>(field_size_ + 1); ++i)
+           if (0 == mul_table_)
+              return;
+
+           /*
+              Rows are filled straight from the log tables, a sum of two
+              logs falling within the doubled anti-log table, and the
+              powers of a symbol stepping through multiples of its log.
+           */
+           const std::size_t columns = field_size_ + 1;
+
+           std::fill(mul_table_, mul_table_ + columns, static_cast<lut_symbol>(0));
+           std::fill(div_table_, div_table_ + columns, static_cast<lut_symbol>(0));
+           std::fill(exp_table_, exp_table_ + columns, static_cast<lut_symbol>(0));
+
+           for (std::size_t i = 1; i < columns; ++i)
            {
-              for (field_symbol j = 0; j < static_cast<field_symbol>(field_size_ + 1); ++j)
+              lut_symbol* mul_row = mul_table_ + (i << power_);
+              lut_symbol* div_row = div_table_ + (i << power_);
+              lut_symbol* exp_row = exp_table_ + (i << power_);
+
+              const field_symbol log_i = index_of_[i];
+
+              mul_row[0] = 0;
+              div_row[0] = 0;
+
+              for (std::size_t j = 1; j < columns; ++j)
+              {
+                 mul_row[j] = static_cast<lut_symbol>(alpha_to_[log_i + index_of_[j]]);
+                 div_row[j] = static_cast<lut_symbol>(alpha_to_[log_i - index_of_[j] + static_cast<field_symbol>(field_size_)]);
+              }
+
+              for (std::size_t j = 0, exponent = 0; j < columns; ++j)
               {
-                 mul_table_[i][j] = gen_mul(i,j);
-                 div_table_[i][j] = gen_div(i,j);
-                 exp_table_[i][j] = gen_exp(i,j);
+                 exp_row[j] = static_cast<lut_symbol>(alpha_to_[exponent]);
+
+                 if ((exponent += log_i) >= field_size_)
+                    exponent -= field_size_;
               }
            }
 
            #ifdef LINEAR_EXP_LUT
-           for (field_symbol i = 0; i < static_cast<field_symbol>(field_size_ + 1); ++i)
+           std::fill(linear_exp_table_, linear_exp_table_ + (2 * columns), static_cast<lut_symbol>(0));
+
+           for (std::size_t i = 1; i < columns; ++i)
            {
-              for (int j = 0; j < static_cast<field_symbol>(2 * field_size_); ++j)
+              lut_symbol* exp_row = linear_exp_table_ + (i << (power_ + 1));
+
+              for (std::size_t j = 0, exponent = 0; j < (2 * field_size_); ++j)
               {
-                 linear_exp_table_[i][j] = gen_exp(i,j);
+                 exp_row[j] = static_cast<lut_symbol>(alpha_to_[exponent]);
+
+                 if ((exponent += index_of_[i]) >= field_size_)
+                    exponent -= field_size_;
               }
            }
            #endif
 
            for (field_symbol i = 0; i < static_cast<field_symbol>(field_size_ + 1); ++i)
            {
-              mul_inverse_[i] = gen_inverse(i);
+              mul_inverse_[i] = static_cast<lut_symbol>(gen_inverse(i));
               mul_inverse_[i + (field_size_ + 1)] = mul_inverse_[i];
            }
 
          #endif
       }
 
-      inline field_symbol field::gen_mul(const field_symbol& a, const field_symbol& b) const
-      {
-         if ((a == 0) || (b == 0))
-           return 0;
-         else
-           return alpha_to_[normalize(index_of_[a] + index_of_[b])];
-      }
-
-      inline field_symbol field::gen_div(const field_symbol& a, const field_symbol& b) const
-      {
-         if ((a == 0) || (b == 0))
-           return 0;
-         else
-           return alpha_to_[normalize(index_of_[a] - index_of_[b] + field_size_)];
-      }
-
-      inline field_symbol field::gen_exp(const field_symbol& a, const std::size_t& n) const
-      {
-         if (a != 0)
-           return ((n == 0) ? 1 : alpha_to_[normalize(index_of_[a] * static_cast<field_symbol>(n))]);
-         else
-           return 0;
-      }
-
       inline field_symbol field::gen_inverse(const field_symbol& val) const
       {
          return alpha_to_[normalize(field_size_ - index_of_[val])];
       }
 
-      std::size_t field::create_array(char buffer[],
-                                      const std::size_t& length,
-                                      const std::size_t offset,
-                                      field_symbol** array)
-      {
-         const std::size_t row_size = length * sizeof(field_symbol);
-         (*array) = new(buffer + offset)field_symbol[length];
-         return row_size + offset;
-      }
-
-      std::size_t field::create_2d_array(char buffer[],
-                                         std::size_t row_cnt, std::size_t col_cnt,
-                                         const std::size_t offset,
-                                         field_symbol*** array)
-      {
-         const std::size_t row_size = col_cnt * sizeof(field_symbol);
-         char* buffer__offset = buffer + offset;
-         (*array) = new field_symbol* [row_cnt];
-         for (std::size_t i = 0; i < row_cnt; ++i)
-         {
-            (*array)[i] = new(buffer__offset + (i * row_size))field_symbol[col_cnt];
-         }
-         return (row_cnt * row_size) + offset;
-      }
-
       inline std::ostream& operator << (std::ostream& os, const field& gf)
       {
          for (std::size_t i = 0; i < (gf.field_size_ + 1); ++i)
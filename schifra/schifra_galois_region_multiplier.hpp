@@ -0,0 +1,378 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_GALOIS_REGION_MULTIPLIER_HPP
+#define INCLUDE_SCHIFRA_GALOIS_REGION_MULTIPLIER_HPP
+
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "schifra_galois_field.hpp"
+
+
+#if !defined(NO_GFSIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+   #define SCHIFRA_GFSIMD_X86
+   #include <immintrin.h>
+#endif
+
+
+namespace schifra
+{
+
+   namespace galois
+   {
+
+      namespace details
+      {
+         /*
+            Region operations, where c is a constant field symbol:
+              e_region_mul       : dst = c * src
+              e_region_mul_add   : dst = c * src + dst
+              e_region_scale_add : dst = c * dst + src  (one step of Horner's rule)
+         */
+         enum region_op
+         {
+            e_region_mul       = 0,
+            e_region_mul_add   = 1,
+            e_region_scale_add = 2
+         };
+
+         struct region_constant
+         {
+            /*
+               Split-nibble product tables: nibble[0..15] holds c * x and
+               nibble[16..31] holds c * (x << 4). The affine member is the
+               8x8 bit-matrix of the GF(2)-linear map x -> c * x in the
+               layout expected by the gf2p8affine instruction.
+            */
+            unsigned char      nibble[32];
+            unsigned long long affine;
+         };
+
+         typedef void (*region_function)(const region_constant&, const unsigned char*, unsigned char*, const std::size_t);
+
+         inline unsigned char region_product(const region_constant& k, const unsigned char x)
+         {
+            return k.nibble[x & 0x0F] ^ k.nibble[16 + (x >> 4)];
+         }
+
+         template <int op>
+         inline void scalar_region(const region_constant& k, const unsigned char* src, unsigned char* dst, const std::size_t length)
+         {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+               switch (op)
+               {
+                  case e_region_mul       : dst[i]  = region_product(k, src[i]);          break;
+                  case e_region_mul_add   : dst[i] ^= region_product(k, src[i]);          break;
+                  case e_region_scale_add : dst[i]  = region_product(k, dst[i]) ^ src[i]; break;
+               }
+            }
+         }
+
+         #ifdef SCHIFRA_GFSIMD_X86
+
+         template <int op>
+         __attribute__((target("ssse3")))
+         void ssse3_region(const region_constant& k, const unsigned char* src, unsigned char* dst, const std::size_t length)
+         {
+            const __m128i lo_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&k.nibble[ 0]));
+            const __m128i hi_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&k.nibble[16]));
+            const __m128i mask     = _mm_set1_epi8(0x0F);
+
+            std::size_t i = 0;
+
+            for ( ; (i + 16) <= length; i += 16)
+            {
+               const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+               const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+               const __m128i x = (e_region_scale_add == op) ? d : s;
+
+               __m128i p = _mm_xor_si128(_mm_shuffle_epi8(lo_table, _mm_and_si128(x, mask)),
+                                         _mm_shuffle_epi8(hi_table, _mm_and_si128(_mm_srli_epi64(x, 4), mask)));
+
+               if (e_region_mul_add   == op) p = _mm_xor_si128(p, d);
+               if (e_region_scale_add == op) p = _mm_xor_si128(p, s);
+
+               _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), p);
+            }
+
+            scalar_region<op>(k, src + i, dst + i, length - i);
+         }
+
+         template <int op>
+         __attribute__((target("avx2")))
+         void avx2_region(const region_constant& k, const unsigned char* src, unsigned char* dst, const std::size_t length)
+         {
+            const __m256i lo_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&k.nibble[ 0])));
+            const __m256i hi_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&k.nibble[16])));
+            const __m256i mask     = _mm256_set1_epi8(0x0F);
+
+            std::size_t i = 0;
+
+            for ( ; (i + 32) <= length; i += 32)
+            {
+               const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+               const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+               const __m256i x = (e_region_scale_add == op) ? d : s;
+
+               __m256i p = _mm256_xor_si256(_mm256_shuffle_epi8(lo_table, _mm256_and_si256(x, mask)),
+                                            _mm256_shuffle_epi8(hi_table, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask)));
+
+               if (e_region_mul_add   == op) p = _mm256_xor_si256(p, d);
+               if (e_region_scale_add == op) p = _mm256_xor_si256(p, s);
+
+               _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), p);
+            }
+
+            scalar_region<op>(k, src + i, dst + i, length - i);
+         }
+
+         template <int op>
+         __attribute__((target("gfni,avx2")))
+         void gfni_avx2_region(const region_constant& k, const unsigned char* src, unsigned char* dst, const std::size_t length)
+         {
+            const __m256i matrix = _mm256_set1_epi64x(static_cast<long long>(k.affine));
+
+            std::size_t i = 0;
+
+            for ( ; (i + 32) <= length; i += 32)
+            {
+               const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+               const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+
+               __m256i p = _mm256_gf2p8affine_epi64_epi8((e_region_scale_add == op) ? d : s, matrix, 0);
+
+               if (e_region_mul_add   == op) p = _mm256_xor_si256(p, d);
+               if (e_region_scale_add == op) p = _mm256_xor_si256(p, s);
+
+               _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), p);
+            }
+
+            scalar_region<op>(k, src + i, dst + i, length - i);
+         }
+
+         template <int op>
+         __attribute__((target("gfni,avx512f,avx512bw")))
+         void gfni_avx512_region(const region_constant& k, const unsigned char* src, unsigned char* dst, const std::size_t length)
+         {
+            const __m512i matrix = _mm512_set1_epi64(static_cast<long long>(k.affine));
+
+            std::size_t i = 0;
+
+            for ( ; (i + 64) <= length; i += 64)
+            {
+               const __m512i s = _mm512_loadu_si512(src + i);
+               const __m512i d = _mm512_loadu_si512(dst + i);
+
+               __m512i p = _mm512_gf2p8affine_epi64_epi8((e_region_scale_add == op) ? d : s, matrix, 0);
+
+               if (e_region_mul_add   == op) p = _mm512_xor_si512(p, d);
+               if (e_region_scale_add == op) p = _mm512_xor_si512(p, s);
+
+               _mm512_storeu_si512(dst + i, p);
+            }
+
+            scalar_region<op>(k, src + i, dst + i, length - i);
+         }
+
+         #endif
+
+      } // namespace details
+
+      class region_multiplier
+      {
+      public:
+
+         enum kernel_type
+         {
+            e_scalar_kernel      = 0,
+            e_ssse3_kernel       = 1,
+            e_avx2_kernel        = 2,
+            e_gfni_avx2_kernel   = 3,
+            e_gfni_avx512_kernel = 4
+         };
+
+         /*
+            Multiply-accumulate over byte regions for GF(2^8). The widest
+            kernel supported by the executing processor, and no wider than
+            max_kernel, is selected once at construction time. Fields of any
+            other size leave the multiplier invalid.
+         */
+         explicit region_multiplier(const field& gfield, const kernel_type max_kernel = e_gfni_avx512_kernel)
+         : valid_(8 == gfield.pwr()),
+           kernel_(e_scalar_kernel),
+           mul_      (details::scalar_region<details::e_region_mul      >),
+           mul_add_  (details::scalar_region<details::e_region_mul_add  >),
+           scale_add_(details::scalar_region<details::e_region_scale_add>)
+         {
+            if (!valid_)
+               return;
+
+            constant_.resize(256);
+
+            for (unsigned int c = 0; c < 256; ++c)
+            {
+               details::region_constant& k = constant_[c];
+
+               for (unsigned int x = 0; x < 16; ++x)
+               {
+                  k.nibble[x     ] = static_cast<unsigned char>(gfield.mul(c, x     ));
+                  k.nibble[x + 16] = static_cast<unsigned char>(gfield.mul(c, x << 4));
+               }
+
+               k.affine = 0;
+
+               for (unsigned int i = 0; i < 8; ++i)
+               {
+                  unsigned long long row = 0;
+
+                  for (unsigned int j = 0; j < 8; ++j)
+                  {
+                     row |= static_cast<unsigned long long>((gfield.mul(c, 1 << j) >> i) & 1) << j;
+                  }
+
+                  k.affine |= row << (8 * (7 - i));
+               }
+            }
+
+            select_kernel(max_kernel);
+         }
+
+         inline bool valid() const
+         {
+            return valid_;
+         }
+
+         inline kernel_type kernel() const
+         {
+            return kernel_;
+         }
+
+         inline const char* kernel_name() const
+         {
+            switch (kernel_)
+            {
+               case e_scalar_kernel      : return "scalar";
+               case e_ssse3_kernel       : return "ssse3";
+               case e_avx2_kernel        : return "avx2";
+               case e_gfni_avx2_kernel   : return "gfni-avx2";
+               case e_gfni_avx512_kernel : return "gfni-avx512";
+               default                   : return "unknown";
+            }
+         }
+
+         /* dst[i] = c * src[i] */
+         inline void mul(const field_symbol c, const unsigned char* src, unsigned char* dst, const std::size_t length) const
+         {
+            if (0 == c)
+               std::memset(dst, 0x00, length);
+            else
+               mul_(constant_[c & 0xFF], src, dst, length);
+         }
+
+         /* dst[i] ^= c * src[i] */
+         inline void mul_add(const field_symbol c, const unsigned char* src, unsigned char* dst, const std::size_t length) const
+         {
+            if (0 != c)
+            {
+               mul_add_(constant_[c & 0xFF], src, dst, length);
+            }
+         }
+
+         /* dst[i] = (c * dst[i]) ^ src[i] */
+         inline void scale_add(const field_symbol c, const unsigned char* src, unsigned char* dst, const std::size_t length) const
+         {
+            if (0 == c)
+               std::memcpy(dst, src, length);
+            else
+               scale_add_(constant_[c & 0xFF], src, dst, length);
+         }
+
+         /* dst[i] ^= src[i] */
+         inline void add(const unsigned char* src, unsigned char* dst, const std::size_t length) const
+         {
+            mul_add_(constant_[1], src, dst, length);
+         }
+
+      private:
+
+         void select_kernel(const kernel_type max_kernel)
+         {
+            kernel_    = e_scalar_kernel;
+            mul_       = details::scalar_region<details::e_region_mul      >;
+            mul_add_   = details::scalar_region<details::e_region_mul_add  >;
+            scale_add_ = details::scalar_region<details::e_region_scale_add>;
+
+            #ifdef SCHIFRA_GFSIMD_X86
+
+            __builtin_cpu_init();
+
+            if ((max_kernel >= e_gfni_avx512_kernel) && __builtin_cpu_supports("gfni") && __builtin_cpu_supports("avx512bw"))
+            {
+               kernel_    = e_gfni_avx512_kernel;
+               mul_       = details::gfni_avx512_region<details::e_region_mul      >;
+               mul_add_   = details::gfni_avx512_region<details::e_region_mul_add  >;
+               scale_add_ = details::gfni_avx512_region<details::e_region_scale_add>;
+            }
+            else if ((max_kernel >= e_gfni_avx2_kernel) && __builtin_cpu_supports("gfni") && __builtin_cpu_supports("avx2"))
+            {
+               kernel_    = e_gfni_avx2_kernel;
+               mul_       = details::gfni_avx2_region<details::e_region_mul      >;
+               mul_add_   = details::gfni_avx2_region<details::e_region_mul_add  >;
+               scale_add_ = details::gfni_avx2_region<details::e_region_scale_add>;
+            }
+            else if ((max_kernel >= e_avx2_kernel) && __builtin_cpu_supports("avx2"))
+            {
+               kernel_    = e_avx2_kernel;
+               mul_       = details::avx2_region<details::e_region_mul      >;
+               mul_add_   = details::avx2_region<details::e_region_mul_add  >;
+               scale_add_ = details::avx2_region<details::e_region_scale_add>;
+            }
+            else if ((max_kernel >= e_ssse3_kernel) && __builtin_cpu_supports("ssse3"))
+            {
+               kernel_    = e_ssse3_kernel;
+               mul_       = details::ssse3_region<details::e_region_mul      >;
+               mul_add_   = details::ssse3_region<details::e_region_mul_add  >;
+               scale_add_ = details::ssse3_region<details::e_region_scale_add>;
+            }
+
+            #else
+               (void)max_kernel;
+            #endif
+         }
+
+         bool                                  valid_;
+         kernel_type                           kernel_;
+         std::vector<details::region_constant> constant_;
+         details::region_function              mul_;
+         details::region_function              mul_add_;
+         details::region_function              scale_add_;
+      };
+
+   } // namespace galois
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,208 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_GALOIS_STATIC_FIELD_HPP
+#define INCLUDE_SCHIFRA_GALOIS_STATIC_FIELD_HPP
+
+
+#include <cstddef>
+
+#include "schifra_ecc_traits.hpp"
+#include "schifra_galois_field.hpp"
+
+
+namespace schifra
+{
+
+   namespace galois
+   {
+
+      namespace details
+      {
+
+         /*
+            Entries of the byte tables of static_field, built on the
+            generators shared with field. Past twice the field size the
+            anti-log table is zero, and the log of zero points there.
+         */
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int i>
+         struct static_byte_alpha_entry
+         {
+            enum { field_size = (1U << power) - 1 };
+            enum { value = (i < (2 * field_size)) ? static_alpha<power,primitive_polynomial,(i % field_size)>::value : 0 };
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v>
+         struct static_log_entry
+         {
+            /* Points past every sum of two logs of non-zero symbols. */
+            enum { value = static_in_field<power,primitive_polynomial,v>::value ? static_cast<int>(static_log<power,primitive_polynomial,v>::value) : 511 };
+         };
+
+         template <unsigned int power, unsigned int primitive_polynomial, unsigned int v>
+         struct static_inverse_entry
+         {
+            enum { field_size = (1U << power) - 1 };
+            enum { value = static_in_field<power,primitive_polynomial,v>::value ?
+                           static_alpha<power,primitive_polynomial,(field_size - static_log<power,primitive_polynomial,v>::value) % field_size>::value : 0 };
+         };
+
+      } // namespace details
+
+      /*
+         Field of up to 2^8 elements whose tables are built by the
+         compiler. The tables are constant aggregates, so they land in
+         read-only data, cost nothing at startup and are indexed directly
+         rather than through per-row pointers. Symbols are kept in bytes.
+         The log of zero points into a zero filled tail of the anti-log
+         table, which makes multiplication free of branches. The
+         interface follows that of field, which itself takes its log
+         and anti-log tables from the same generators for the built-in
+         polynomials of degree 8.
+      */
+      template <unsigned int field_power, unsigned int primitive_polynomial>
+      class static_field
+      {
+      public:
+
+         typedef unsigned char symbol_type;
+
+         enum { power      = field_power             };
+         enum { field_size = (1U << field_power) - 1 };
+
+         inline std::size_t size() const
+         {
+            return field_size;
+         }
+
+         inline unsigned int pwr() const
+         {
+            return power;
+         }
+
+         inline field_symbol index(const field_symbol value) const
+         {
+            return (0 != value) ? index_of_[value] : GFERROR;
+         }
+
+         inline field_symbol alpha(const field_symbol value) const
+         {
+            return alpha_to_[value];
+         }
+
+         inline field_symbol add(const field_symbol& a, const field_symbol& b) const
+         {
+            return (a ^ b);
+         }
+
+         inline field_symbol sub(const field_symbol& a, const field_symbol& b) const
+         {
+            return (a ^ b);
+         }
+
+         inline field_symbol mul(const field_symbol& a, const field_symbol& b) const
+         {
+            return alpha_to_[index_of_[a] + index_of_[b]];
+         }
+
+         inline field_symbol div(const field_symbol& a, const field_symbol& b) const
+         {
+            if ((0 == a) || (0 == b))
+               return 0;
+            else
+               return alpha_to_[index_of_[a] + field_size - index_of_[b]];
+         }
+
+         inline field_symbol exp(const field_symbol& a, const int n) const
+         {
+            if (0 == a)
+               return 0;
+
+            const std::size_t exponent = (n < 0) ? (field_size - (static_cast<std::size_t>(-(n + 1)) % field_size) - 1) :
+                                                   (static_cast<std::size_t>(n) % field_size);
+
+            return alpha_to_[(static_cast<std::size_t>(index_of_[a]) * exponent) % field_size];
+         }
+
+         inline field_symbol inverse(const field_symbol& val) const
+         {
+            return mul_inverse_[val];
+         }
+
+      private:
+
+         typedef traits::__static_assert__<(field_power >= 2) && (field_power <= 8)> byte_sized_field;
+
+         static const unsigned char  alpha_to_   [4 * 256];
+         static const unsigned short index_of_   [256];
+         static const unsigned char  mul_inverse_[256];
+      };
+
+      /*
+         The tables are spelt out with the repeat macros of
+         schifra_galois_field.hpp, each entry being evaluated by the
+         compiler.
+      */
+      #define schifra_static_field_alpha(offset,i) \
+         details::static_byte_alpha_entry<field_power,primitive_polynomial,(offset) + (i)>::value,
+
+      #define schifra_static_field_entry(entry,i) \
+         details::static_##entry##_entry<field_power,primitive_polynomial,i>::value,
+
+      template <unsigned int field_power, unsigned int primitive_polynomial>
+      const unsigned char static_field<field_power,primitive_polynomial>::alpha_to_[4 * 256] =
+      {
+         schifra_static_field_repeat256(schifra_static_field_alpha,  0)
+         schifra_static_field_repeat256(schifra_static_field_alpha,256)
+         schifra_static_field_repeat256(schifra_static_field_alpha,512)
+         schifra_static_field_repeat256(schifra_static_field_alpha,768)
+      };
+
+      template <unsigned int field_power, unsigned int primitive_polynomial>
+      const unsigned short static_field<field_power,primitive_polynomial>::index_of_[256] =
+      {
+         schifra_static_field_repeat256(schifra_static_field_entry,log)
+      };
+
+      template <unsigned int field_power, unsigned int primitive_polynomial>
+      const unsigned char static_field<field_power,primitive_polynomial>::mul_inverse_[256] =
+      {
+         schifra_static_field_repeat256(schifra_static_field_entry,inverse)
+      };
+
+      #undef schifra_static_field_alpha
+      #undef schifra_static_field_entry
+
+      /* Compile time counterparts of primitive_polynomial00 - primitive_polynomial06 */
+      typedef static_field<3,0x00B> static_field00;
+      typedef static_field<4,0x013> static_field01;
+      typedef static_field<5,0x025> static_field02;
+      typedef static_field<6,0x043> static_field03;
+      typedef static_field<7,0x089> static_field04;
+      typedef static_field<8,0x11D> static_field05;
+      typedef static_field<8,0x187> static_field06;
+
+   } // namespace galois
+
+} // namespace schifra
+
+#endif
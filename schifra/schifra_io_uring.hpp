@@ -0,0 +1,405 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_IO_URING_HPP
+#define INCLUDE_SCHIFRA_IO_URING_HPP
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <linux/io_uring.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <sys/syscall.h>
+  #include <sys/types.h>
+  #include <sys/uio.h>
+  #include <unistd.h>
+#endif
+
+
+namespace schifra
+{
+
+   namespace fileio
+   {
+
+      /*
+         Minimal io_uring submission/completion queue pair, driven
+         directly through the system calls so that no liburing is needed.
+         Reads and writes are queued, handed to the kernel in one go by
+         submit(), and their completions collected one at a time by wait().
+         Buffers registered up front are referred to by index, sparing the
+         kernel from mapping them on every request. Only available on
+         Linux, elsewhere initialisation always fails.
+      */
+      class io_uring_queue
+      {
+      public:
+
+         io_uring_queue()
+         : ring_fd_(-1),
+           entries_(0),
+           pending_(0),
+           sq_ring_(0),
+           cq_ring_(0),
+           sqes_(0),
+           sq_ring_size_(0),
+           cq_ring_size_(0),
+           sqes_size_(0),
+           sq_head_(0),
+           sq_tail_(0),
+           sq_mask_(0),
+           sq_array_(0),
+           cq_head_(0),
+           cq_tail_(0),
+           cq_mask_(0),
+           cqes_(0)
+         {}
+
+        ~io_uring_queue()
+         {
+            close();
+         }
+
+         inline bool initialise(const unsigned int entries)
+         {
+            close();
+
+            #if defined(__linux__)
+
+            struct io_uring_params params;
+
+            std::memset(&params, 0x00, sizeof(params));
+
+            ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+
+            if (ring_fd_ < 0)
+               return false;
+
+            entries_      = params.sq_entries;
+            sq_ring_size_ = params.sq_off.array + (params.sq_entries * sizeof(unsigned int));
+            cq_ring_size_ = params.cq_off.cqes  + (params.cq_entries * sizeof(struct io_uring_cqe));
+            sqes_size_    = params.sq_entries * sizeof(struct io_uring_sqe);
+
+            if (params.features & IORING_FEAT_SINGLE_MMAP)
+            {
+               sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+            }
+
+            sq_ring_ = map(sq_ring_size_, IORING_OFF_SQ_RING);
+
+            if (0 == sq_ring_)
+            {
+               close();
+               return false;
+            }
+
+            if (params.features & IORING_FEAT_SINGLE_MMAP)
+               cq_ring_ = sq_ring_;
+            else if (0 == (cq_ring_ = map(cq_ring_size_, IORING_OFF_CQ_RING)))
+            {
+               close();
+               return false;
+            }
+
+            if (0 == (sqes_ = map(sqes_size_, IORING_OFF_SQES)))
+            {
+               close();
+               return false;
+            }
+
+            sq_head_  = reinterpret_cast<unsigned int*>(sq_ring_ + params.sq_off.head        );
+            sq_tail_  = reinterpret_cast<unsigned int*>(sq_ring_ + params.sq_off.tail        );
+            sq_mask_  = reinterpret_cast<unsigned int*>(sq_ring_ + params.sq_off.ring_mask   );
+            sq_array_ = reinterpret_cast<unsigned int*>(sq_ring_ + params.sq_off.array       );
+            cq_head_  = reinterpret_cast<unsigned int*>(cq_ring_ + params.cq_off.head        );
+            cq_tail_  = reinterpret_cast<unsigned int*>(cq_ring_ + params.cq_off.tail        );
+            cq_mask_  = reinterpret_cast<unsigned int*>(cq_ring_ + params.cq_off.ring_mask   );
+            cqes_     = reinterpret_cast<struct io_uring_cqe*>(cq_ring_ + params.cq_off.cqes );
+
+            return true;
+
+            #else
+
+            (void)entries;
+            return false;
+
+            #endif
+         }
+
+         /*
+            Register buffer_count buffers, given as base/length pairs, for
+            use by index. Fails harmlessly, for instance when the locked
+            memory limit is too low, in which case requests are simply made
+            without a buffer index.
+         */
+         inline bool register_buffers(void* const buffer[], const std::size_t length[], const std::size_t buffer_count)
+         {
+            #if defined(__linux__)
+
+            if ((ring_fd_ < 0) || (0 == buffer_count))
+               return false;
+
+            std::vector<struct iovec> iov(buffer_count);
+
+            for (std::size_t i = 0; i < buffer_count; ++i)
+            {
+               iov[i].iov_base = buffer[i];
+               iov[i].iov_len  = length[i];
+            }
+
+            return (0 == ::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_BUFFERS, &iov[0], static_cast<unsigned int>(buffer_count)));
+
+            #else
+
+            (void)buffer;
+            (void)length;
+            (void)buffer_count;
+            return false;
+
+            #endif
+         }
+
+         /*
+            Queue a read or write of length bytes at the given file offset.
+            A negative buffer index denotes an unregistered buffer. The
+            request only reaches the kernel with the next submit().
+         */
+         inline bool queue_read(const int fd, void* buffer, const std::size_t length, const unsigned long long offset,
+                                const int buffer_index, const unsigned long long user_data)
+         {
+            return queue_request(true, fd, buffer, length, offset, buffer_index, user_data);
+         }
+
+         inline bool queue_write(const int fd, const void* buffer, const std::size_t length, const unsigned long long offset,
+                                 const int buffer_index, const unsigned long long user_data)
+         {
+            return queue_request(false, fd, const_cast<void*>(buffer), length, offset, buffer_index, user_data);
+         }
+
+         inline bool submit()
+         {
+            #if defined(__linux__)
+
+            while (pending_ > 0)
+            {
+               const long result = ::syscall(__NR_io_uring_enter, ring_fd_, pending_, 0, 0, 0, 0);
+
+               if (result < 0)
+               {
+                  if ((EINTR == errno) || (EAGAIN == errno) || (EBUSY == errno))
+                     continue;
+
+                  return false;
+               }
+
+               pending_ -= static_cast<unsigned int>(result);
+            }
+
+            return true;
+
+            #else
+
+            return false;
+
+            #endif
+         }
+
+         /*
+            Wait for the next completion, returning the user data of its
+            request and the result - the byte count transferred, or a
+            negated errno value.
+         */
+         inline bool wait(unsigned long long& user_data, int& result)
+         {
+            #if defined(__linux__)
+
+            for ( ; ; )
+            {
+               const unsigned int head = *cq_head_;
+
+               if (head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+               {
+                  const struct io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+
+                  user_data = cqe.user_data;
+                  result    = cqe.res;
+
+                  __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+
+                  return true;
+               }
+
+               if (::syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, 0, 0) < 0)
+               {
+                  if (EINTR != errno)
+                     return false;
+               }
+            }
+
+            #else
+
+            (void)user_data;
+            (void)result;
+            return false;
+
+            #endif
+         }
+
+         inline void close()
+         {
+            #if defined(__linux__)
+
+            if (0 != sqes_)
+               ::munmap(sqes_, sqes_size_);
+
+            if ((0 != cq_ring_) && (cq_ring_ != sq_ring_))
+               ::munmap(cq_ring_, cq_ring_size_);
+
+            if (0 != sq_ring_)
+               ::munmap(sq_ring_, sq_ring_size_);
+
+            if (ring_fd_ >= 0)
+               ::close(ring_fd_);
+
+            #endif
+
+            ring_fd_ = -1;
+            entries_ = 0;
+            pending_ = 0;
+            sq_ring_ = 0;
+            cq_ring_ = 0;
+            sqes_    = 0;
+         }
+
+         inline unsigned int entries() const
+         {
+            return entries_;
+         }
+
+      private:
+
+         io_uring_queue(const io_uring_queue&);
+         io_uring_queue& operator=(const io_uring_queue&);
+
+         #if defined(__linux__)
+
+         inline unsigned char* map(const std::size_t size, const unsigned long long offset)
+         {
+            void* data = ::mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, static_cast<off_t>(offset));
+
+            return (MAP_FAILED == data) ? 0 : static_cast<unsigned char*>(data);
+         }
+
+         #endif
+
+         inline bool queue_request(const bool read, const int fd, void* buffer, const std::size_t length,
+                                   const unsigned long long offset, const int buffer_index,
+                                   const unsigned long long user_data)
+         {
+            #if defined(__linux__)
+
+            if (ring_fd_ < 0)
+               return false;
+
+            const unsigned int tail = *sq_tail_;
+
+            if ((tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE)) >= entries_)
+               return false;
+
+            const unsigned int index = tail & *sq_mask_;
+
+            struct io_uring_sqe& sqe = reinterpret_cast<struct io_uring_sqe*>(sqes_)[index];
+
+            std::memset(&sqe, 0x00, sizeof(sqe));
+
+            if (buffer_index >= 0)
+            {
+               sqe.opcode    = read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+               sqe.buf_index = static_cast<unsigned short>(buffer_index);
+            }
+            else
+               sqe.opcode    = read ? IORING_OP_READ : IORING_OP_WRITE;
+
+            sqe.fd        = fd;
+            sqe.off       = offset;
+            sqe.addr      = reinterpret_cast<unsigned long>(buffer);
+            sqe.len       = static_cast<unsigned int>(length);
+            sqe.user_data = user_data;
+
+            sq_array_[index] = index;
+
+            __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+            ++pending_;
+
+            return true;
+
+            #else
+
+            (void)read;
+            (void)fd;
+            (void)buffer;
+            (void)length;
+            (void)offset;
+            (void)buffer_index;
+            (void)user_data;
+            return false;
+
+            #endif
+         }
+
+         int            ring_fd_;
+         unsigned int   entries_;
+         unsigned int   pending_;
+         unsigned char* sq_ring_;
+         unsigned char* cq_ring_;
+         unsigned char* sqes_;
+         std::size_t    sq_ring_size_;
+         std::size_t    cq_ring_size_;
+         std::size_t    sqes_size_;
+         unsigned int*  sq_head_;
+         unsigned int*  sq_tail_;
+         unsigned int*  sq_mask_;
+         unsigned int*  sq_array_;
+         unsigned int*  cq_head_;
+         unsigned int*  cq_tail_;
+         unsigned int*  cq_mask_;
+         #if defined(__linux__)
+         struct io_uring_cqe* cqes_;
+         #else
+         void* cqes_;
+         #endif
+      };
+
+   } // namespace fileio
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,225 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_MAPPED_FILE_HPP
+#define INCLUDE_SCHIFRA_MAPPED_FILE_HPP
+
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+
+#if !defined(_WIN32) && !defined(__WIN32__) && !defined(WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <sys/types.h>
+  #include <unistd.h>
+#endif
+
+
+namespace schifra
+{
+
+   namespace fileio
+   {
+
+      /*
+         A file mapped into memory in its entirety. Inputs are mapped
+         private, so they may be modified in memory, for instance while
+         being corrected in place, without any change reaching the file,
+         and only the pages actually written are ever copied. Outputs are
+         created at their final size and mapped shared, so what is stored
+         into the mapping is what ends up in the file. The space of an
+         output is allocated up front, as a store into a sparse mapping
+         on a full disk raises SIGBUS rather than an error, and closing
+         an output writes it back synchronously, reporting whether that
+         succeeded. Only available on POSIX systems, elsewhere opening
+         always fails.
+      */
+      class mapped_file
+      {
+      public:
+
+         mapped_file()
+         : data_(0),
+           size_(0),
+           output_(false)
+         {}
+
+        ~mapped_file()
+         {
+            close();
+         }
+
+         inline bool open_input(const std::string& file_name)
+         {
+            close();
+
+            #if !defined(_WIN32) && !defined(__WIN32__) && !defined(WIN32)
+
+            const int fd = ::open(file_name.c_str(), O_RDONLY);
+
+            if (fd < 0)
+               return false;
+
+            struct stat file_status;
+
+            if ((0 != ::fstat(fd,&file_status)) || (file_status.st_size <= 0))
+            {
+               ::close(fd);
+               return false;
+            }
+
+            const std::size_t size = static_cast<std::size_t>(file_status.st_size);
+
+            void* data = ::mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+            ::close(fd);
+
+            if (MAP_FAILED == data)
+               return false;
+
+            ::madvise(data, size, MADV_SEQUENTIAL);
+
+            data_ = static_cast<unsigned char*>(data);
+            size_ = size;
+
+            return true;
+
+            #else
+
+            (void)file_name;
+            return false;
+
+            #endif
+         }
+
+         inline bool create_output(const std::string& file_name, const std::size_t size)
+         {
+            close();
+
+            #if !defined(_WIN32) && !defined(__WIN32__) && !defined(WIN32)
+
+            if (0 == size)
+               return false;
+
+            const int fd = ::open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+            if (fd < 0)
+               return false;
+
+            int result = 0;
+
+            do
+            {
+               result = ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+            }
+            while (EINTR == result);
+
+            if (0 != result)
+            {
+               ::close(fd);
+               ::unlink(file_name.c_str());
+               return false;
+            }
+
+            void* data = ::mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+            ::close(fd);
+
+            if (MAP_FAILED == data)
+            {
+               ::unlink(file_name.c_str());
+               return false;
+            }
+
+            ::madvise(data, size, MADV_SEQUENTIAL);
+
+            data_   = static_cast<unsigned char*>(data);
+            size_   = size;
+            output_ = true;
+
+            return true;
+
+            #else
+
+            (void)file_name;
+            (void)size;
+            return false;
+
+            #endif
+         }
+
+         /*
+            Unmap the file, an output being first written back. Returns
+            false if the write back or the unmapping failed.
+         */
+         inline bool close()
+         {
+            bool result = true;
+
+            #if !defined(_WIN32) && !defined(__WIN32__) && !defined(WIN32)
+
+            if (0 != data_)
+            {
+               if (output_ && (0 != ::msync(data_, size_, MS_SYNC)))
+                  result = false;
+
+               if (0 != ::munmap(data_, size_))
+                  result = false;
+            }
+
+            #endif
+
+            data_   = 0;
+            size_   = 0;
+            output_ = false;
+
+            return result;
+         }
+
+         inline unsigned char* data()
+         {
+            return data_;
+         }
+
+         inline std::size_t size() const
+         {
+            return size_;
+         }
+
+      private:
+
+         mapped_file(const mapped_file&);
+         mapped_file& operator=(const mapped_file&);
+
+         unsigned char* data_;
+         std::size_t    size_;
+         bool           output_;
+      };
+
+   } // namespace fileio
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,169 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+/*
+   Description: Benchmark of the Reed-Solomon codecs, sweeping fec length,
+                error density, part size and thread count. The results
+                are written as JSON or CSV, and when given a baseline CSV
+                from an earlier run the medians are compared against it,
+                the exit status being non-zero upon any regression.
+                The faster key equation solver of each code is reported.
+
+   Usage: schifra_reed_solomon_benchmark [-f json|csv] [-o output_file]
+                                         [-b baseline.csv] [-t tolerance]
+                                         [-r repetitions] [-q]
+*/
+
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "schifra_reed_solomon_benchmark.hpp"
+
+
+template <std::size_t code_length, std::size_t fec_length>
+void print_key_equation_solver(const schifra::reed_solomon::benchmark_report& report)
+{
+   typedef schifra::reed_solomon::decoder<code_length,fec_length> decoder_t;
+
+   const bool euclidean = (decoder_t::e_euclidean == schifra::reed_solomon::select_key_equation_solver<code_length,fec_length>(report));
+
+   std::cerr << "RS(" << code_length << "," << (code_length - fec_length) << ") key equation solver: "
+             << (euclidean ? "euclidean" : "berlekamp_massey") << std::endl;
+}
+
+
+int main(int argc, char* argv[])
+{
+   std::string format             = "json";
+   std::string output_file_name;
+   std::string baseline_file_name;
+   double      tolerance          = 0.05;
+   bool        quick              = false;
+
+   schifra::reed_solomon::benchmark_options options;
+
+   for (int i = 1; i < argc; ++i)
+   {
+      const std::string option = argv[i];
+      const bool has_value     = (i + 1) < argc;
+
+      if      (("-f" == option) && has_value) format             = argv[++i];
+      else if (("-o" == option) && has_value) output_file_name   = argv[++i];
+      else if (("-b" == option) && has_value) baseline_file_name = argv[++i];
+      else if (("-t" == option) && has_value) tolerance          = std::atof(argv[++i]);
+      else if (("-r" == option) && has_value) options.repetitions = static_cast<std::size_t>(std::atoi(argv[++i]));
+      else if  ("-q" == option)               quick              = true;
+      else
+      {
+         std::cerr << "Usage: " << argv[0] << " [-f json|csv] [-o output_file] [-b baseline.csv] [-t tolerance] [-r repetitions] [-q]" << std::endl;
+         return 1;
+      }
+   }
+
+   if (quick)
+   {
+      options.repetitions    = 5;
+      options.workload_bytes = 262144;
+      options.file_bytes     = 4 * 1048576;
+   }
+
+   std::vector<std::size_t> part_size_list;
+
+   part_size_list.push_back(  65536);
+   part_size_list.push_back(1048576);
+
+   if (!quick)
+   {
+      part_size_list.push_back(4 * 1048576);
+   }
+
+   std::vector<std::size_t> thread_count_list;
+
+   thread_count_list.push_back(1);
+   thread_count_list.push_back(2);
+   thread_count_list.push_back(4);
+
+   if (!quick)
+   {
+      thread_count_list.push_back(8);
+   }
+
+   schifra::reed_solomon::benchmark_report report;
+
+   schifra::reed_solomon::benchmark_code<255,  8>(options,part_size_list,report);
+   schifra::reed_solomon::benchmark_code<255, 16>(options,part_size_list,report);
+   schifra::reed_solomon::benchmark_code<255, 32>(options,part_size_list,report);
+   schifra::reed_solomon::benchmark_code<255, 64>(options,part_size_list,report);
+
+   schifra::reed_solomon::benchmark_file_code<1048576,255,32>(options,thread_count_list,report);
+
+   print_key_equation_solver<255,  8>(report);
+   print_key_equation_solver<255, 16>(report);
+   print_key_equation_solver<255, 32>(report);
+   print_key_equation_solver<255, 64>(report);
+
+   std::ofstream output_file;
+
+   if (!output_file_name.empty())
+   {
+      output_file.open(output_file_name.c_str());
+
+      if (!output_file)
+      {
+         std::cerr << "Error - Failed to create output file: " << output_file_name << std::endl;
+         return 1;
+      }
+   }
+
+   std::ostream& output = output_file_name.empty() ? std::cout : output_file;
+
+   if ("csv" == format)
+      report.write_csv(output);
+   else
+      report.write_json(output);
+
+   if (!baseline_file_name.empty())
+   {
+      std::ifstream baseline_file(baseline_file_name.c_str());
+      schifra::reed_solomon::benchmark_report baseline;
+
+      if (!baseline_file || !baseline.read_csv(baseline_file))
+      {
+         std::cerr << "Error - Failed to read baseline file: " << baseline_file_name << std::endl;
+         return 1;
+      }
+
+      const std::size_t regressions = report.compare(baseline,tolerance,std::cerr);
+
+      std::cerr << "Regressions against baseline: " << regressions << std::endl;
+
+      if (regressions > 0)
+         return 1;
+   }
+
+   return 0;
+}
@@ -0,0 +1,1026 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_BENCHMARK_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_BENCHMARK_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "schifra_galois_field.hpp"
+#include "schifra_galois_field_polynomial.hpp"
+#include "schifra_sequential_root_generator_polynomial_creator.hpp"
+#include "schifra_reed_solomon_block.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_reed_solomon_parallel_file_encoder.hpp"
+#include "schifra_reed_solomon_parallel_file_decoder.hpp"
+#include "schifra_error_processes.hpp"
+#include "schifra_fileio.hpp"
+#include "schifra_utilities.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Benchmark harness for the codecs. A workload is run once to warm
+         up and then a number of timed repetitions, each repetition giving
+         one throughput sample in MiB/s of data symbols. When built with
+         SCHIFRA_DECODER_PROFILE the decoder stage profile of the timed
+         repetitions of each case is printed as well. The samples of a
+         case are summarised as percentiles into a benchmark_report, which
+         can be written as JSON or CSV, read back from CSV and compared
+         against a baseline report to catch regressions.
+      */
+
+      struct benchmark_case
+      {
+         benchmark_case()
+         : code_length(0),
+           fec_length(0),
+           error_count(0),
+           thread_count(0),
+           part_size(0)
+         {}
+
+         benchmark_case(const std::string& test_name,
+                        const std::size_t  n,
+                        const std::size_t  fec,
+                        const std::size_t  errors  = 0,
+                        const std::size_t  threads = 1,
+                        const std::size_t  part    = 0)
+         : test(test_name),
+           code_length(n),
+           fec_length(fec),
+           error_count(errors),
+           thread_count(threads),
+           part_size(part)
+         {}
+
+         /* Identifies the case when matching results against a baseline. */
+         inline std::string key() const
+         {
+            std::ostringstream stream;
+
+            stream << test         << '/'
+                   << code_length  << '/'
+                   << fec_length   << '/'
+                   << error_count  << '/'
+                   << thread_count << '/'
+                   << part_size;
+
+            return stream.str();
+         }
+
+         std::string test;
+         std::size_t code_length;
+         std::size_t fec_length;
+         std::size_t error_count;
+         std::size_t thread_count;
+         std::size_t part_size;
+      };
+
+      struct benchmark_summary
+      {
+         benchmark_summary()
+         : bytes(0),
+           repetitions(0),
+           failures(0),
+           min(0.0),
+           p50(0.0),
+           p90(0.0),
+           p99(0.0),
+           max(0.0),
+           mean(0.0)
+         {}
+
+         benchmark_summary(const benchmark_case&      case_parameters,
+                           const std::size_t          bytes_per_repetition,
+                           const std::size_t          failure_count,
+                           const std::vector<double>& rate_list)
+         : parameters(case_parameters),
+           bytes(bytes_per_repetition),
+           repetitions(rate_list.size()),
+           failures(failure_count),
+           min(0.0),
+           p50(0.0),
+           p90(0.0),
+           p99(0.0),
+           max(0.0),
+           mean(0.0)
+         {
+            if (rate_list.empty())
+               return;
+
+            std::vector<double> sorted(rate_list);
+
+            std::sort(sorted.begin(),sorted.end());
+
+            min = sorted.front();
+            max = sorted.back();
+            p50 = percentile(sorted,50.0);
+            p90 = percentile(sorted,90.0);
+            p99 = percentile(sorted,99.0);
+
+            double total = 0.0;
+
+            for (std::size_t i = 0; i < sorted.size(); ++i)
+            {
+               total += sorted[i];
+            }
+
+            mean = total / sorted.size();
+         }
+
+         /* Nearest rank percentile of an ascending sample list. */
+         static inline double percentile(const std::vector<double>& sorted, const double p)
+         {
+            const std::size_t rank = static_cast<std::size_t>(std::ceil((p / 100.0) * sorted.size()));
+
+            return sorted[(rank > 0) ? std::min(rank, sorted.size()) - 1 : 0];
+         }
+
+         benchmark_case parameters;
+         std::size_t    bytes;
+         std::size_t    repetitions;
+         std::size_t    failures;
+         double         min;
+         double         p50;
+         double         p90;
+         double         p99;
+         double         max;
+         double         mean;
+      };
+
+      class benchmark_report
+      {
+      public:
+
+         inline void add(const benchmark_summary& summary)
+         {
+            summary_list_.push_back(summary);
+         }
+
+         inline const std::vector<benchmark_summary>& summary_list() const
+         {
+            return summary_list_;
+         }
+
+         inline void write_json(std::ostream& stream) const
+         {
+            stream << "{\n   \"unit\": \"MiB/s\",\n   \"results\": [\n";
+
+            for (std::size_t i = 0; i < summary_list_.size(); ++i)
+            {
+               const benchmark_summary& s = summary_list_[i];
+
+               stream << "      { "
+                      << "\"test\": \""       << s.parameters.test << "\", "
+                      << "\"code_length\": "  << s.parameters.code_length  << ", "
+                      << "\"fec_length\": "   << s.parameters.fec_length   << ", "
+                      << "\"error_count\": "  << s.parameters.error_count  << ", "
+                      << "\"thread_count\": " << s.parameters.thread_count << ", "
+                      << "\"part_size\": "    << s.parameters.part_size    << ", "
+                      << "\"bytes\": "        << s.bytes       << ", "
+                      << "\"repetitions\": "  << s.repetitions << ", "
+                      << "\"failures\": "     << s.failures    << ", "
+                      << "\"min\": "  << format_rate(s.min ) << ", "
+                      << "\"p50\": "  << format_rate(s.p50 ) << ", "
+                      << "\"p90\": "  << format_rate(s.p90 ) << ", "
+                      << "\"p99\": "  << format_rate(s.p99 ) << ", "
+                      << "\"max\": "  << format_rate(s.max ) << ", "
+                      << "\"mean\": " << format_rate(s.mean) << " }"
+                      << (((i + 1) < summary_list_.size()) ? ",\n" : "\n");
+            }
+
+            stream << "   ]\n}\n";
+         }
+
+         inline void write_csv(std::ostream& stream) const
+         {
+            stream << csv_header() << "\n";
+
+            for (std::size_t i = 0; i < summary_list_.size(); ++i)
+            {
+               const benchmark_summary& s = summary_list_[i];
+
+               stream << s.parameters.test         << ','
+                      << s.parameters.code_length  << ','
+                      << s.parameters.fec_length   << ','
+                      << s.parameters.error_count  << ','
+                      << s.parameters.thread_count << ','
+                      << s.parameters.part_size    << ','
+                      << s.bytes       << ','
+                      << s.repetitions << ','
+                      << s.failures    << ','
+                      << format_rate(s.min ) << ','
+                      << format_rate(s.p50 ) << ','
+                      << format_rate(s.p90 ) << ','
+                      << format_rate(s.p99 ) << ','
+                      << format_rate(s.max ) << ','
+                      << format_rate(s.mean) << "\n";
+            }
+         }
+
+         /* Load a report previously written by write_csv, such as a stored baseline. */
+         inline bool read_csv(std::istream& stream)
+         {
+            std::string line;
+
+            if (!std::getline(stream,line) || (line != csv_header()))
+               return false;
+
+            while (std::getline(stream,line))
+            {
+               if (line.empty())
+                  continue;
+
+               std::replace(line.begin(),line.end(),',',' ');
+
+               std::istringstream fields(line);
+               benchmark_summary s;
+
+               fields >> s.parameters.test
+                      >> s.parameters.code_length
+                      >> s.parameters.fec_length
+                      >> s.parameters.error_count
+                      >> s.parameters.thread_count
+                      >> s.parameters.part_size
+                      >> s.bytes
+                      >> s.repetitions
+                      >> s.failures
+                      >> s.min
+                      >> s.p50
+                      >> s.p90
+                      >> s.p99
+                      >> s.max
+                      >> s.mean;
+
+               if (fields.fail())
+                  return false;
+
+               summary_list_.push_back(s);
+            }
+
+            return true;
+         }
+
+         /*
+            Compare the median throughput of each case against the same
+            case in the baseline, reporting those that have slowed down by
+            more than tolerance (a fraction, 0.05 being 5%) and those that
+            newly fail. Returns the number of regressions found.
+         */
+         inline std::size_t compare(const benchmark_report& baseline,
+                                    const double            tolerance,
+                                    std::ostream&           log) const
+         {
+            std::map<std::string,const benchmark_summary*> baseline_map;
+
+            for (std::size_t i = 0; i < baseline.summary_list_.size(); ++i)
+            {
+               baseline_map[baseline.summary_list_[i].parameters.key()] = &baseline.summary_list_[i];
+            }
+
+            std::size_t regressions = 0;
+
+            for (std::size_t i = 0; i < summary_list_.size(); ++i)
+            {
+               const benchmark_summary& current = summary_list_[i];
+
+               const std::map<std::string,const benchmark_summary*>::const_iterator itr =
+                  baseline_map.find(current.parameters.key());
+
+               if (baseline_map.end() == itr)
+                  continue;
+
+               const benchmark_summary& previous = *itr->second;
+
+               const double ratio = (previous.p50 > 0.0) ? (current.p50 / previous.p50) : 1.0;
+
+               if ((current.failures > 0) && (0 == previous.failures))
+               {
+                  log << "REGRESSION " << current.parameters.key() << " now has " << current.failures << " failure(s)" << std::endl;
+                  ++regressions;
+               }
+               else if (ratio < (1.0 - tolerance))
+               {
+                  log << "REGRESSION " << current.parameters.key()
+                      << " p50 " << format_rate(previous.p50) << " -> " << format_rate(current.p50)
+                      << " MiB/s (" << format_rate(100.0 * (ratio - 1.0)) << "%)" << std::endl;
+                  ++regressions;
+               }
+               else if (ratio > (1.0 + tolerance))
+               {
+                  log << "IMPROVED   " << current.parameters.key()
+                      << " p50 " << format_rate(previous.p50) << " -> " << format_rate(current.p50)
+                      << " MiB/s (+" << format_rate(100.0 * (ratio - 1.0)) << "%)" << std::endl;
+               }
+            }
+
+            return regressions;
+         }
+
+      private:
+
+         static inline std::string csv_header()
+         {
+            return "test,code_length,fec_length,error_count,thread_count,part_size,bytes,repetitions,failures,min,p50,p90,p99,max,mean";
+         }
+
+         static inline std::string format_rate(const double rate)
+         {
+            char buffer[64];
+            std::sprintf(buffer,"%.3f",rate);
+            return buffer;
+         }
+
+         std::vector<benchmark_summary> summary_list_;
+      };
+
+      struct benchmark_options
+      {
+         benchmark_options()
+         : repetitions(20),
+           workload_bytes(1048576),
+           file_bytes(16 * 1048576),
+           verbose(true)
+         {}
+
+         std::size_t repetitions;
+         std::size_t workload_bytes;
+         std::size_t file_bytes;
+         bool        verbose;
+      };
+
+      /*
+         A workload provides reset(), which restores its input between
+         repetitions outside of the timed region, run(), which performs
+         one timed repetition and returns the number of failures, and
+         bytes(), the number of data bytes a repetition processes.
+      */
+      template <typename Workload>
+      inline void run_benchmark(Workload&                workload,
+                                const benchmark_case&    parameters,
+                                const benchmark_options& options,
+                                benchmark_report&        report)
+      {
+         std::vector<double> rate_list;
+         std::size_t failures = 0;
+
+         workload.reset();
+         workload.run();
+
+         reset_decoder_profile();
+
+         for (std::size_t r = 0; r < options.repetitions; ++r)
+         {
+            workload.reset();
+
+            schifra::utils::timer timer;
+            timer.start();
+            failures += workload.run();
+            timer.stop();
+
+            const double time = std::max(timer.time(), 0.000001);
+
+            rate_list.push_back(workload.bytes() / (1048576.0 * time));
+         }
+
+         const benchmark_summary summary(parameters, workload.bytes(), failures, rate_list);
+
+         if (options.verbose)
+         {
+            std::fprintf(stderr,"%-40s p50:%10.3fMiB/s  p90:%10.3fMiB/s  failures:%d\n",
+                         parameters.key().c_str(),
+                         summary.p50,
+                         summary.p90,
+                         static_cast<int>(failures));
+
+            #if defined(SCHIFRA_DECODER_PROFILE)
+            const decoder_profile profile = decoder_profile_snapshot();
+
+            if (profile.block_count() > 0)
+            {
+               profile.dump(std::cerr);
+            }
+            #endif
+         }
+
+         report.add(summary);
+      }
+
+      /*
+         Encoder and decoder over GF(2^8) sharing a field and generator,
+         as used by every workload below.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      class benchmark_codec
+      {
+      public:
+
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef decoder<code_length,fec_length> decoder_type;
+
+         enum { field_descriptor = 8   };
+         enum { gen_poly_index   = 120 };
+
+         typedef typename decoder_type::key_equation_solver_t key_equation_solver_t;
+
+         explicit benchmark_codec(const key_equation_solver_t key_equation_solver = decoder_type::e_berlekamp_massey)
+         : field_(field_descriptor,
+                  galois::primitive_polynomial_size06,
+                  galois::primitive_polynomial06),
+           generator_polynomial_(field_),
+           valid_(make_sequential_root_generator_polynomial(field_,
+                                                            gen_poly_index,
+                                                            fec_length,
+                                                            generator_polynomial_)),
+           encoder_(field_,generator_polynomial_),
+           decoder_(field_,gen_poly_index,key_equation_solver)
+         {}
+
+         inline bool valid() const
+         {
+            return valid_;
+         }
+
+         inline const encoder_type& rs_encoder() const
+         {
+            return encoder_;
+         }
+
+         inline const decoder_type& rs_decoder() const
+         {
+            return decoder_;
+         }
+
+      private:
+
+         benchmark_codec(const benchmark_codec&);
+         benchmark_codec& operator=(const benchmark_codec&);
+
+         galois::field            field_;
+         galois::field_polynomial generator_polynomial_;
+         bool                     valid_;
+         encoder_type             encoder_;
+         decoder_type             decoder_;
+      };
+
+      /* Fill buffer with reproducible pseudo-random bytes. */
+      inline void benchmark_fill(unsigned char* buffer, const std::size_t length, unsigned int seed)
+      {
+         for (std::size_t i = 0; i < length; ++i)
+         {
+            seed = (seed * 1103515245U) + 12345U;
+            buffer[i] = static_cast<unsigned char>(seed >> 16);
+         }
+      }
+
+      template <std::size_t code_length, std::size_t fec_length>
+      class block_encode_workload
+      {
+      public:
+
+         typedef benchmark_codec<code_length,fec_length> codec_type;
+         typedef block<code_length,fec_length> block_type;
+
+         enum { data_length = code_length - fec_length };
+
+         block_encode_workload(const codec_type& codec, const benchmark_options& options)
+         : codec_(codec),
+           block_list_(std::max<std::size_t>(1, options.workload_bytes / data_length))
+         {
+            for (std::size_t i = 0; i < block_list_.size(); ++i)
+            {
+               unsigned char message[data_length];
+
+               benchmark_fill(message, data_length, static_cast<unsigned int>(i));
+
+               for (std::size_t j = 0; j < data_length; ++j)
+               {
+                  block_list_[i][j] = message[j];
+               }
+            }
+         }
+
+         inline void reset()
+         {}
+
+         inline std::size_t run()
+         {
+            std::size_t failures = 0;
+
+            for (std::size_t i = 0; i < block_list_.size(); ++i)
+            {
+               if (!codec_.rs_encoder().encode(block_list_[i]))
+                  ++failures;
+            }
+
+            return failures;
+         }
+
+         inline std::size_t bytes() const
+         {
+            return block_list_.size() * data_length;
+         }
+
+      private:
+
+         const codec_type&       codec_;
+         std::vector<block_type> block_list_;
+      };
+
+      /*
+         Decoding of individual codewords each carrying error_count errors
+         at pseudo-random positions, or error_count erasures in a burst
+         when erasures is set. An error_count of zero measures the clean
+         path, being the syndrome computation alone.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      class block_decode_workload
+      {
+      public:
+
+         typedef benchmark_codec<code_length,fec_length> codec_type;
+         typedef block<code_length,fec_length> block_type;
+         typedef typename codec_type::decoder_type::workspace_type workspace_type;
+
+         enum { data_length = code_length - fec_length };
+
+         block_decode_workload(const codec_type&        codec,
+                               const benchmark_options& options,
+                               const std::size_t        error_count,
+                               const bool               erasures = false)
+         : codec_(codec),
+           received_list_(std::max<std::size_t>(1, options.workload_bytes / data_length)),
+           block_list_(received_list_.size()),
+           erasure_list_(erasures ? received_list_.size() : 0)
+         {
+            std::vector<std::size_t> error_index;
+
+            generate_error_index(code_length, error_index, 0);
+
+            for (std::size_t i = 0; i < received_list_.size(); ++i)
+            {
+               unsigned char message[data_length];
+
+               benchmark_fill(message, data_length, static_cast<unsigned int>(i));
+
+               block_type& rsblock = received_list_[i];
+
+               for (std::size_t j = 0; j < data_length; ++j)
+               {
+                  rsblock[j] = message[j];
+               }
+
+               codec_.rs_encoder().encode(rsblock);
+
+               if (erasures)
+                  corrupt_message_all_erasures(rsblock, erasure_list_[i], error_count, (i * 7) % code_length);
+               else
+                  corrupt_message_all_errors_at_index(rsblock, error_count, i * 7, error_index);
+            }
+         }
+
+         inline void reset()
+         {
+            std::copy(received_list_.begin(), received_list_.end(), block_list_.begin());
+         }
+
+         inline std::size_t run()
+         {
+            std::size_t failures = 0;
+
+            for (std::size_t i = 0; i < block_list_.size(); ++i)
+            {
+               const bool result = erasure_list_.empty() ?
+                                   codec_.rs_decoder().decode(block_list_[i], workspace_) :
+                                   codec_.rs_decoder().decode(block_list_[i], erasure_list_[i], workspace_);
+               if (!result)
+                  ++failures;
+            }
+
+            return failures;
+         }
+
+         inline std::size_t bytes() const
+         {
+            return block_list_.size() * data_length;
+         }
+
+      private:
+
+         const codec_type&                codec_;
+         std::vector<block_type>          received_list_;
+         std::vector<block_type>          block_list_;
+         std::vector<erasure_locations_t> erasure_list_;
+         workspace_type                   workspace_;
+      };
+
+      /*
+         In-memory encoding, decoding or transposition of whole parts of
+         the file codec format, see file_part_codec. Encoded parts carry
+         error_count errors in every codeword for decoding. Transposition
+         is the row order extraction alone, as done for intact parts.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      class part_workload
+      {
+      public:
+
+         typedef benchmark_codec<code_length,fec_length> codec_type;
+
+         enum { data_length = code_length - fec_length };
+
+         enum operation_type
+         {
+            e_encode,
+            e_decode,
+            e_transpose
+         };
+
+         part_workload(const codec_type&        codec,
+                       const benchmark_options& options,
+                       const operation_type     operation,
+                       const std::size_t        part_size,
+                       const std::size_t        error_count = 0)
+         : codec_(codec),
+           operation_(operation),
+           part_rows_(std::max<std::size_t>(1, part_size / data_length)),
+           part_count_(std::max<std::size_t>(1, options.workload_bytes / (part_rows_ * data_length))),
+           data_(part_count_ * part_rows_ * data_length),
+           encoded_(part_count_ * part_rows_ * code_length),
+           received_(encoded_.size()),
+           output_(std::max(data_.size(), encoded_.size()))
+         {
+            benchmark_fill(&data_[0], data_.size(), 0xA5A5A5A5U);
+
+            std::vector<std::size_t> error_index;
+
+            generate_error_index(code_length, error_index, 0);
+
+            for (std::size_t p = 0; p < part_count_; ++p)
+            {
+               unsigned char* part = &encoded_[p * part_rows_ * code_length];
+
+               encode_part(codec_.rs_encoder(), &data_[p * part_rows_ * data_length], part_rows_ * data_length, part);
+
+               for (std::size_t j = 0; j < part_rows_; ++j)
+               {
+                  for (std::size_t e = 0; e < error_count; ++e)
+                  {
+                     const std::size_t position = error_index[((j * 7) + e) % code_length];
+
+                     part[(position * part_rows_) + j] ^= 0xFF;
+                  }
+               }
+            }
+         }
+
+         inline void reset()
+         {
+            if (e_decode == operation_)
+            {
+               std::memcpy(&received_[0], &encoded_[0], encoded_.size());
+            }
+         }
+
+         inline std::size_t run()
+         {
+            std::size_t failures = 0;
+
+            for (std::size_t p = 0; p < part_count_; ++p)
+            {
+               const std::size_t data_offset    = p * part_rows_ * data_length;
+               const std::size_t encoded_offset = p * part_rows_ * code_length;
+
+               switch (operation_)
+               {
+                  case e_encode    : if (!encode_part(codec_.rs_encoder(),
+                                                      &data_[data_offset],
+                                                      part_rows_ * data_length,
+                                                      &output_[encoded_offset]))
+                                        ++failures;
+                                     break;
+
+                  case e_decode    : if (!decode_part(codec_.rs_decoder(),
+                                                      &received_[encoded_offset],
+                                                      part_rows_ * code_length,
+                                                      &output_[data_offset],
+                                                      failures))
+                                        ++failures;
+                                     break;
+
+                  case e_transpose : if (!extract_part<code_length,fec_length>(&encoded_[encoded_offset],
+                                                                               part_rows_ * code_length,
+                                                                               &output_[data_offset]))
+                                        ++failures;
+                                     break;
+               }
+            }
+
+            return failures;
+         }
+
+         inline std::size_t bytes() const
+         {
+            return data_.size();
+         }
+
+      private:
+
+         const codec_type&          codec_;
+         const operation_type       operation_;
+         const std::size_t          part_rows_;
+         const std::size_t          part_count_;
+         std::vector<unsigned char> data_;
+         std::vector<unsigned char> encoded_;
+         std::vector<unsigned char> received_;
+         std::vector<unsigned char> output_;
+      };
+
+      /*
+         Encoding or decoding of a whole file through the threaded file
+         pipelines, including disk I/O. Temporary files are created in
+         the working directory and removed on destruction.
+      */
+      template <std::size_t part_size_bytes, std::size_t code_length, std::size_t fec_length>
+      class file_workload
+      {
+      public:
+
+         typedef benchmark_codec<code_length,fec_length> codec_type;
+         typedef parallel_file_encoder<part_size_bytes,code_length,fec_length> file_encoder_type;
+         typedef parallel_file_decoder<part_size_bytes,code_length,fec_length> file_decoder_type;
+
+         file_workload(const codec_type&        codec,
+                       const benchmark_options& options,
+                       const bool               decode,
+                       const std::size_t        thread_count)
+         : codec_(codec),
+           decode_(decode),
+           thread_count_(thread_count),
+           bytes_(options.file_bytes),
+           input_file_name_  ("schifra_benchmark.dat"),
+           encoded_file_name_("schifra_benchmark.schifra"),
+           decoded_file_name_("schifra_benchmark.decoded")
+         {
+            std::string data(bytes_,0x00);
+
+            benchmark_fill(reinterpret_cast<unsigned char*>(&data[0]), data.size(), 0x5A5A5A5AU);
+
+            schifra::fileio::write_file(input_file_name_,data);
+
+            if (decode_)
+            {
+               const file_encoder_type file_encoder(codec_.rs_encoder(), input_file_name_, encoded_file_name_, thread_count_);
+            }
+         }
+
+        ~file_workload()
+         {
+            std::remove(input_file_name_  .c_str());
+            std::remove(encoded_file_name_.c_str());
+            std::remove(decoded_file_name_.c_str());
+         }
+
+         inline void reset()
+         {}
+
+         inline std::size_t run()
+         {
+            if (decode_)
+            {
+               const file_decoder_type file_decoder(codec_.rs_decoder(), encoded_file_name_, decoded_file_name_, thread_count_);
+               return file_decoder.success() ? 0 : 1;
+            }
+            else
+            {
+               const file_encoder_type file_encoder(codec_.rs_encoder(), input_file_name_, encoded_file_name_, thread_count_);
+               return file_encoder.success() ? 0 : 1;
+            }
+         }
+
+         inline std::size_t bytes() const
+         {
+            return bytes_;
+         }
+
+      private:
+
+         file_workload(const file_workload&);
+         file_workload& operator=(const file_workload&);
+
+         const codec_type& codec_;
+         const bool        decode_;
+         const std::size_t thread_count_;
+         const std::size_t bytes_;
+         const std::string input_file_name_;
+         const std::string encoded_file_name_;
+         const std::string decoded_file_name_;
+      };
+
+      /*
+         Sweep of the codeword and in-memory part workloads of one code:
+         encoding, decoding at error densities of 0, 1/4, 1/2, 3/4 and all
+         of the correction capability, erasure decoding at 1/2 and all of
+         fec_length, and part encoding, decoding and transposition at the
+         given part sizes. Codeword decoding is measured with each of the
+         key equation solvers, the euclidean cases being suffixed with
+         _euclidean, see select_key_equation_solver.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      inline void benchmark_code(const benchmark_options&        options,
+                                 const std::vector<std::size_t>& part_size_list,
+                                 benchmark_report&               report)
+      {
+         typedef benchmark_codec<code_length,fec_length> codec_type;
+         typedef part_workload<code_length,fec_length> part_workload_type;
+
+         const codec_type codec;
+         const codec_type euclidean_codec(codec_type::decoder_type::e_euclidean);
+
+         if (!codec.valid())
+            return;
+
+         {
+            block_encode_workload<code_length,fec_length> workload(codec,options);
+            run_benchmark(workload, benchmark_case("encode",code_length,fec_length), options, report);
+         }
+
+         const std::size_t t = fec_length / 2;
+         const std::size_t error_count_list[] = { 0, t / 4, t / 2, (3 * t) / 4, t };
+
+         for (std::size_t i = 0; i < sizeof(error_count_list) / sizeof(std::size_t); ++i)
+         {
+            if ((i > 0) && (error_count_list[i] == error_count_list[i - 1]))
+               continue;
+
+            block_decode_workload<code_length,fec_length> workload(codec, options, error_count_list[i]);
+            run_benchmark(workload, benchmark_case("decode",code_length,fec_length,error_count_list[i]), options, report);
+
+            if (0 == error_count_list[i])
+               continue;
+
+            block_decode_workload<code_length,fec_length> euclidean_workload(euclidean_codec, options, error_count_list[i]);
+            run_benchmark(euclidean_workload, benchmark_case("decode_euclidean",code_length,fec_length,error_count_list[i]), options, report);
+         }
+
+         const std::size_t erasure_count_list[] = { fec_length / 2, fec_length };
+
+         for (std::size_t i = 0; i < sizeof(erasure_count_list) / sizeof(std::size_t); ++i)
+         {
+            block_decode_workload<code_length,fec_length> workload(codec, options, erasure_count_list[i], true);
+            run_benchmark(workload, benchmark_case("erasure_decode",code_length,fec_length,erasure_count_list[i]), options, report);
+
+            block_decode_workload<code_length,fec_length> euclidean_workload(euclidean_codec, options, erasure_count_list[i], true);
+            run_benchmark(euclidean_workload, benchmark_case("erasure_decode_euclidean",code_length,fec_length,erasure_count_list[i]), options, report);
+         }
+
+         for (std::size_t i = 0; i < part_size_list.size(); ++i)
+         {
+            const std::size_t part_size = part_size_list[i];
+
+            {
+               part_workload_type workload(codec, options, part_workload_type::e_encode, part_size);
+               run_benchmark(workload, benchmark_case("part_encode",code_length,fec_length,0,1,part_size), options, report);
+            }
+
+            {
+               part_workload_type workload(codec, options, part_workload_type::e_decode, part_size);
+               run_benchmark(workload, benchmark_case("part_decode",code_length,fec_length,0,1,part_size), options, report);
+            }
+
+            {
+               part_workload_type workload(codec, options, part_workload_type::e_decode, part_size, t / 2);
+               run_benchmark(workload, benchmark_case("part_decode",code_length,fec_length,t / 2,1,part_size), options, report);
+            }
+
+            {
+               part_workload_type workload(codec, options, part_workload_type::e_transpose, part_size);
+               run_benchmark(workload, benchmark_case("part_transpose",code_length,fec_length,0,1,part_size), options, report);
+            }
+         }
+      }
+
+      /*
+         The key equation solver taking the least total time over the
+         codeword decode cases of a code with errors or erasures, as
+         measured by benchmark_code into report.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      inline typename decoder<code_length,fec_length>::key_equation_solver_t
+      select_key_equation_solver(const benchmark_report& report)
+      {
+         typedef decoder<code_length,fec_length> decoder_type;
+
+         const std::string suffix = "_euclidean";
+
+         std::map<std::string,double> median_map;
+
+         for (std::size_t i = 0; i < report.summary_list().size(); ++i)
+         {
+            const benchmark_summary& summary = report.summary_list()[i];
+
+            if ((summary.parameters.code_length == code_length) && (summary.parameters.fec_length == fec_length))
+            {
+               median_map[summary.parameters.key()] = summary.p50;
+            }
+         }
+
+         double bma_time       = 0.0;
+         double euclidean_time = 0.0;
+
+         for (std::map<std::string,double>::const_iterator itr = median_map.begin(); itr != median_map.end(); ++itr)
+         {
+            const std::string& key = itr->first;
+            const std::size_t  end = key.find('/');
+
+            if ((end < suffix.size()) || (key.compare(end - suffix.size(), suffix.size(), suffix) != 0))
+               continue;
+
+            const std::map<std::string,double>::const_iterator bma_itr =
+               median_map.find(key.substr(0, end - suffix.size()) + key.substr(end));
+
+            if ((median_map.end() == bma_itr) || (bma_itr->second <= 0.0) || (itr->second <= 0.0))
+               continue;
+
+            bma_time       += 1.0 / bma_itr->second;
+            euclidean_time += 1.0 / itr->second;
+         }
+
+         return ((euclidean_time > 0.0) && (euclidean_time < bma_time)) ?
+                decoder_type::e_euclidean :
+                decoder_type::e_berlekamp_massey;
+      }
+
+      /* Sweep of the threaded file encoder and decoder over thread counts. */
+      template <std::size_t part_size_bytes, std::size_t code_length, std::size_t fec_length>
+      inline void benchmark_file_code(const benchmark_options&        options,
+                                      const std::vector<std::size_t>& thread_count_list,
+                                      benchmark_report&               report)
+      {
+         typedef benchmark_codec<code_length,fec_length> codec_type;
+         typedef file_workload<part_size_bytes,code_length,fec_length> file_workload_type;
+
+         const codec_type codec;
+
+         if (!codec.valid())
+            return;
+
+         for (std::size_t i = 0; i < thread_count_list.size(); ++i)
+         {
+            const std::size_t thread_count = thread_count_list[i];
+
+            {
+               file_workload_type workload(codec, options, false, thread_count);
+               run_benchmark(workload, benchmark_case("file_encode",code_length,fec_length,0,thread_count,part_size_bytes), options, report);
+            }
+
+            {
+               file_workload_type workload(codec, options, true, thread_count);
+               run_benchmark(workload, benchmark_case("file_decode",code_length,fec_length,0,thread_count,part_size_bytes), options, report);
+            }
+         }
+      }
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
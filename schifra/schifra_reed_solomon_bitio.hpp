@@ -43,11 +43,11 @@ namespace schifra
          {
          public:
 
-            template <typename BitBlock>
-            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, int symbol[])
+            template <typename BitBlock, typename Symbol>
+            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, Symbol symbol[])
             {
                const BitBlock* d_it = &  data[0];
-               int*            s_it = &symbol[0];
+               Symbol*         s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; ++i, ++d_it, s_it+=4)
                {
@@ -64,11 +64,11 @@ namespace schifra
          {
          public:
 
-            template <typename BitBlock>
-            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, int symbol[])
+            template <typename BitBlock, typename Symbol>
+            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, Symbol symbol[])
             {
                const BitBlock* d_it = &  data[0];
-               int*            s_it = &symbol[0];
+               Symbol*         s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; ++i, ++d_it, s_it+=2)
                {
@@ -83,11 +83,11 @@ namespace schifra
          {
          public:
 
-            template <typename BitBlock>
-            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, int symbol[])
+            template <typename BitBlock, typename Symbol>
+            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, Symbol symbol[])
             {
                const BitBlock* d_it = &  data[0];
-               int*            s_it = &symbol[0];
+               Symbol*         s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; ++i, ++d_it, ++s_it)
                {
@@ -101,11 +101,11 @@ namespace schifra
          {
          public:
 
-            template <typename BitBlock>
-            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, int symbol[])
+            template <typename BitBlock, typename Symbol>
+            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, Symbol symbol[])
             {
                const BitBlock* d_it = &  data[0];
-               int*            s_it = &symbol[0];
+               Symbol*         s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; i+=2, d_it+=2, ++s_it)
                {
@@ -120,11 +120,11 @@ namespace schifra
          {
          public:
 
-            template <typename BitBlock>
-            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, int symbol[])
+            template <typename BitBlock, typename Symbol>
+            convert_data_to_symbol(const BitBlock data[], const std::size_t data_length, Symbol symbol[])
             {
                BitBlock* d_it = &  data[0];
-               int*      s_it = &symbol[0];
+               Symbol*   s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; i+=3, d_it+=3, ++s_it)
                {
@@ -142,11 +142,11 @@ namespace schifra
          {
          public:
 
-            template <typename BitBlock>
-            convert_symbol_to_data(const int symbol[], BitBlock data[], const std::size_t data_length)
+            template <typename BitBlock, typename Symbol>
+            convert_symbol_to_data(const Symbol symbol[], BitBlock data[], const std::size_t data_length)
             {
                BitBlock*  d_it = &  data[0];
-               const int* s_it = &symbol[0];
+               const Symbol* s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; ++i, ++d_it, ++s_it)
                {
@@ -160,11 +160,11 @@ namespace schifra
          class convert_symbol_to_data<8>
          {
          public:
-            template <typename BitBlock>
-            convert_symbol_to_data(const int symbol[], BitBlock data[], const std::size_t data_length)
+            template <typename BitBlock, typename Symbol>
+            convert_symbol_to_data(const Symbol symbol[], BitBlock data[], const std::size_t data_length)
             {
                BitBlock*  d_it = &  data[0];
-               const int* s_it = &symbol[0];
+               const Symbol* s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; ++i, ++d_it, ++s_it)
                {
@@ -178,11 +178,11 @@ namespace schifra
          {
          public:
 
-            template <typename BitBlock>
-            convert_symbol_to_data(const int symbol[], BitBlock data[], const std::size_t data_length)
+            template <typename BitBlock, typename Symbol>
+            convert_symbol_to_data(const Symbol symbol[], BitBlock data[], const std::size_t data_length)
             {
                BitBlock*  d_it = &  data[0];
-               const int* s_it = &symbol[0];
+               const Symbol* s_it = &symbol[0];
 
                for (std::size_t i = 0; i < data_length; ++i, ++d_it, ++s_it)
                {
@@ -24,6 +24,7 @@
 #define INCLUDE_SCHIFRA_REED_SOLOMON_BLOCK_HPP
 
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 
@@ -37,12 +38,17 @@ namespace schifra
    namespace reed_solomon
    {
 
+      /*
+         A codeword, its symbols being held in the narrowest type able
+         to represent them (see traits::symbol_storage), one byte each
+         for codes over GF(2^m) with m <= 8.
+      */
       template <std::size_t code_length, std::size_t fec_length, std::size_t data_length = code_length - fec_length>
       struct block
       {
       public:
 
-         typedef galois::field_symbol symbol_type;
+         typedef typename traits::symbol_storage<code_length>::type symbol_type;
          typedef traits::reed_solomon_triat<code_length,fec_length,data_length> trait;
          typedef traits::symbol<code_length> symbol;
          typedef block<code_length,fec_length,data_length> block_t;
@@ -80,31 +86,36 @@ namespace schifra
 
             for (std::size_t i = 0; i < data_length; ++i)
             {
-               data[i] = static_cast<galois::field_symbol>(_data[i]);
+               data[i] = static_cast<symbol_type>(_data[i]);
             }
 
             for (std::size_t i = 0; i < fec_length; ++i)
             {
-               data[i + data_length] = static_cast<galois::field_symbol>(_fec[i]);
+               data[i + data_length] = static_cast<symbol_type>(_fec[i]);
             }
          }
 
-         galois::field_symbol& operator[](const std::size_t& index)
+         symbol_type& operator[](const std::size_t& index)
          {
             return data[index];
          }
 
-         const galois::field_symbol& operator[](const std::size_t& index) const
+         const symbol_type& operator[](const std::size_t& index) const
          {
             return data[index];
          }
 
-         galois::field_symbol& operator()(const std::size_t& index)
+         symbol_type& operator()(const std::size_t& index)
          {
             return operator[](index);
          }
 
-         galois::field_symbol& fec(const std::size_t& index)
+         symbol_type& fec(const std::size_t& index)
+         {
+            return data[data_length + index];
+         }
+
+         const symbol_type& fec(const std::size_t& index) const
          {
             return data[data_length + index];
          }
@@ -148,26 +159,17 @@ namespace schifra
 
          void clear(galois::field_symbol value = 0)
          {
-            for (std::size_t i = 0; i < code_length; ++i)
-            {
-               data[i] = value;
-            }
+            std::fill_n(data, code_length, static_cast<symbol_type>(value));
          }
 
          void clear_data(galois::field_symbol value = 0)
          {
-            for (std::size_t i = 0; i < data_length; ++i)
-            {
-               data[i] = value;
-            }
+            std::fill_n(data, data_length, static_cast<symbol_type>(value));
          }
 
          void clear_fec(galois::field_symbol value = 0)
          {
-            for (std::size_t i = 0; i < fec_length; ++i)
-            {
-               data[data_length + i] = value;
-            }
+            std::fill_n(data + data_length, fec_length, static_cast<symbol_type>(value));
          }
 
          void reset(galois::field_symbol value = 0)
@@ -211,16 +213,13 @@ namespace schifra
          std::size_t  zero_numerators;
          bool           unrecoverable;
          error_t                error;
-         galois::field_symbol data[code_length];
+         symbol_type          data[code_length];
       };
 
       template <std::size_t code_length, std::size_t fec_length>
       inline void copy(const block<code_length,fec_length>& src_block, block<code_length,fec_length>& dest_block)
       {
-         for (std::size_t index = 0; index < code_length; ++index)
-         {
-            dest_block.data[index] = src_block.data[index];
-         }
+         std::copy(src_block.data, src_block.data + code_length, dest_block.data);
       }
 
       template <typename T, std::size_t code_length, std::size_t fec_length>
@@ -28,7 +28,11 @@
 int main()
 {
    bool codec_validation_result = schifra::reed_solomon::codec_validation_test00() &&
-                                  schifra::reed_solomon::codec_validation_test01() ;
+                                  schifra::reed_solomon::codec_validation_test01() &&
+                                  schifra::reed_solomon::codec_validation_test02() &&
+                                  schifra::reed_solomon::codec_validation_test03() &&
+                                  schifra::reed_solomon::codec_validation_test04() &&
+                                  schifra::reed_solomon::codec_validation_test05() ;
 
    if (codec_validation_result)
    {
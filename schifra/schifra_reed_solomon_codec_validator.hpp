@@ -24,18 +24,34 @@
 #define INCLUDE_SCHIFRA_REED_SOLOMON_CODEC_VALIDATOR_HPP
 
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdio>
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <string>
+#include <vector>
 
+#include "schifra_crc.hpp"
 #include "schifra_galois_field.hpp"
 #include "schifra_galois_field_polynomial.hpp"
+#include "schifra_galois_region_multiplier.hpp"
+#include "schifra_galois_static_field.hpp"
 #include "schifra_sequential_root_generator_polynomial_creator.hpp"
 #include "schifra_reed_solomon_block.hpp"
 #include "schifra_reed_solomon_encoder.hpp"
 #include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_container.hpp"
+#include "schifra_reed_solomon_file_encoder.hpp"
+#include "schifra_reed_solomon_file_decoder.hpp"
+#include "schifra_reed_solomon_file_scrubber.hpp"
+#include "schifra_reed_solomon_file_update_encoder.hpp"
+#include "schifra_reed_solomon_stream_codec.hpp"
+#include "schifra_erasure_channel.hpp"
 #include "schifra_ecc_traits.hpp"
 #include "schifra_error_processes.hpp"
+#include "schifra_fileio.hpp"
 #include "schifra_utilities.hpp"
 
 
@@ -959,6 +975,128 @@ namespace schifra
          return true;
       }
 
+      template <std::size_t field_descriptor,
+                std::size_t gen_poly_index,
+                std::size_t natural_length,
+                std::size_t code_length,
+                std::size_t fec_length>
+      inline bool shortened_native_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef shortened_encoder<code_length,fec_length,code_length - fec_length,natural_length> encoder_type;
+         typedef shortened_decoder<code_length,fec_length,code_length - fec_length,natural_length> decoder_type;
+         typedef encoder<natural_length,fec_length> natural_encoder_type;
+         typedef block<code_length,fec_length> block_type;
+         typedef block<natural_length,fec_length> natural_block_type;
+
+         const std::size_t data_length    = code_length - fec_length;
+         const std::size_t padding_length = natural_length - code_length;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type         rs_encoder(field,generator_polynomial);
+         const decoder_type         rs_decoder(field,gen_poly_index);
+         const natural_encoder_type natural_encoder(field,generator_polynomial);
+
+         block_type         original_block;
+         natural_block_type natural_block;
+
+         original_block.clear();
+         natural_block.clear();
+
+         for (std::size_t i = 0; i < data_length; ++i)
+         {
+            original_block.data[i] = static_cast<galois::field_symbol>((i * 53 + 7) & field.mask());
+            natural_block.data[padding_length + i] = original_block.data[i];
+         }
+
+         rs_encoder.encode(original_block);
+         natural_encoder.encode(natural_block);
+
+         /*
+            The native shortened encoding must equal that of the full
+            length code over the zero padded data.
+         */
+         for (std::size_t i = 0; i < fec_length; ++i)
+         {
+            if (original_block.fec(i) != natural_block.fec(i))
+            {
+               std::cout << "shortened_native_validation_test() - Parity Mismatch! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") "
+                         << "fec index: " << i << std::endl;
+               return false;
+            }
+         }
+
+         std::vector<std::size_t> error_index;
+
+         generate_error_index(code_length,error_index,0);
+
+         typename decoder_type::workspace_type workspace;
+
+         for (std::size_t erasure_count = 0; erasure_count <= fec_length; ++erasure_count)
+         {
+            for (std::size_t error_count = 0; (2 * error_count + erasure_count) <= fec_length; ++error_count)
+            {
+               const std::size_t start = (erasure_count * 31 + error_count * 17) % code_length;
+
+               block_type rs_block = original_block;
+               erasure_locations_t erasure_list;
+
+               for (std::size_t i = 0; i < (erasure_count + error_count); ++i)
+               {
+                  const std::size_t position = error_index[(start + i) % code_length];
+
+                  rs_block.data[position] ^= static_cast<galois::field_symbol>(1 + ((start + i * 13) % field.mask()));
+
+                  if (i < erasure_count)
+                     erasure_list.push_back(position);
+               }
+
+               if (!rs_decoder.decode(rs_block,erasure_list,workspace))
+               {
+                  std::cout << "shortened_native_validation_test() - Decoding Failure! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") "
+                            << "erasures: " << erasure_count << " errors: " << error_count << std::endl;
+                  return false;
+               }
+               else if (!are_blocks_equivelent(rs_block,original_block))
+               {
+                  std::cout << "shortened_native_validation_test() - Error Correcting Failure! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") "
+                            << "erasures: " << erasure_count << " errors: " << error_count << std::endl;
+                  return false;
+               }
+            }
+         }
+
+         /*
+            The tail of a full length codeword that is non-zero at one of
+            the padding positions appears as a single error among the
+            implied zeros, which must be reported as uncorrectable rather
+            than be silently corrected into the padding.
+         */
+         natural_block.data[padding_length / 2] = 1;
+         natural_encoder.encode(natural_block);
+
+         block_type rs_block;
+
+         for (std::size_t i = 0; i < code_length; ++i)
+         {
+            rs_block.data[i] = natural_block.data[padding_length + i];
+         }
+
+         if (rs_decoder.decode(rs_block))
+         {
+            std::cout << "shortened_native_validation_test() - Padding Error Not Detected! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ")" << std::endl;
+            return false;
+         }
+
+         return true;
+      }
+
       inline bool codec_validation_test00()
       {
          return codec_validation_test<8,120,255,  2>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
@@ -988,7 +1126,1819 @@ namespace schifra
                 shortened_codec_validation_test<8,  1,204,16>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) && /* DBV/MPEG-2 TSP RS Code */
                 shortened_codec_validation_test<8,  1,104,27>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) && /* Magnetic Storage Outer RS Code */
                 shortened_codec_validation_test<8,  1,204,12>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) && /* Magnetic Storage Inner RS Code */
-                shortened_codec_validation_test<8,120, 72,10>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) ;  /* VDL Mode 3 RS Code */
+                shortened_codec_validation_test<8,120, 72,10>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&  /* VDL Mode 3 RS Code */
+                shortened_native_validation_test<4,0, 15, 10, 4>(galois::primitive_polynomial_size01,galois::primitive_polynomial01) &&
+                shortened_native_validation_test<8,120,255, 72,10>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                shortened_native_validation_test<8,  1,255,204,16>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) ;
+      }
+
+      inline bool region_multiplier_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         galois::field field(8,prim_poly_size,prim_poly);
+
+         const std::size_t length = 259;
+
+         unsigned char src[length];
+         unsigned char dst[length];
+         unsigned char aux[length];
+
+         for (int k = galois::region_multiplier::e_scalar_kernel; k <= galois::region_multiplier::e_gfni_avx512_kernel; ++k)
+         {
+            const galois::region_multiplier region(field,static_cast<galois::region_multiplier::kernel_type>(k));
+
+            for (galois::field_symbol c = 0; c < 256; ++c)
+            {
+               for (std::size_t i = 0; i < length; ++i)
+               {
+                  src[i] = static_cast<unsigned char>(i * 7 + c);
+                  aux[i] = static_cast<unsigned char>(i * 13 + 5);
+               }
+
+               std::copy(aux, aux + length, dst);
+               region.mul(c,src,dst,length);
+
+               for (std::size_t i = 0; i < length; ++i)
+               {
+                  if (dst[i] != field.mul(c,src[i]))
+                  {
+                     std::cout << "region_multiplier_validation_test() - mul failure kernel: " << region.kernel_name() << std::endl;
+                     return false;
+                  }
+               }
+
+               std::copy(aux, aux + length, dst);
+               region.mul_add(c,src,dst,length);
+
+               for (std::size_t i = 0; i < length; ++i)
+               {
+                  if (dst[i] != (field.mul(c,src[i]) ^ aux[i]))
+                  {
+                     std::cout << "region_multiplier_validation_test() - mul_add failure kernel: " << region.kernel_name() << std::endl;
+                     return false;
+                  }
+               }
+
+               std::copy(aux, aux + length, dst);
+               region.scale_add(c,src,dst,length);
+
+               for (std::size_t i = 0; i < length; ++i)
+               {
+                  if (dst[i] != (field.mul(c,aux[i]) ^ src[i]))
+                  {
+                     std::cout << "region_multiplier_validation_test() - scale_add failure kernel: " << region.kernel_name() << std::endl;
+                     return false;
+                  }
+               }
+            }
+         }
+
+         return true;
+      }
+
+      /* Product of a and b in GF(2^power) a bit at a time, polynomial being the primitive polynomial as a bit mask. */
+      inline galois::field_symbol reference_field_mul(galois::field_symbol a, galois::field_symbol b, const unsigned int power, const unsigned int polynomial)
+      {
+         galois::field_symbol product = 0;
+
+         for ( ; 0 != b; b >>= 1)
+         {
+            if (b & 1)
+               product ^= a;
+
+            a <<= 1;
+
+            if (a >> power)
+               a ^= static_cast<galois::field_symbol>(polynomial);
+         }
+
+         return product;
+      }
+
+      inline galois::field_symbol reference_field_exp(galois::field_symbol a, std::size_t n, const unsigned int power, const unsigned int polynomial)
+      {
+         galois::field_symbol result = (0 != a) ? 1 : 0;
+
+         for ( ; (0 != a) && (0 != n); n >>= 1)
+         {
+            if (n & 1)
+               result = reference_field_mul(result,a,power,polynomial);
+
+            a = reference_field_mul(a,a,power,polynomial);
+         }
+
+         return result;
+      }
+
+      /*
+         Check the log and anti-log tables and the arithmetic of field
+         against bitwise multiplication by the primitive polynomial, on
+         every step-th symbol and the symbols of the largest logs, and
+         whether the compiler built tables are in use.
+      */
+      inline bool field_arithmetic_validation_test(const unsigned int power,
+                                                   const std::size_t prim_poly_size,
+                                                   const unsigned int prim_poly[],
+                                                   const bool static_tables,
+                                                   const galois::field_symbol step)
+      {
+         const galois::field field(power,prim_poly_size,prim_poly);
+
+         const galois::field_symbol field_size = static_cast<galois::field_symbol>(field.size());
+
+         unsigned int polynomial = 0;
+
+         for (std::size_t i = 0; i < prim_poly_size; ++i)
+         {
+            polynomial |= (prim_poly[i] ? 1U : 0U) << i;
+         }
+
+         if (field.static_tables() != static_tables)
+         {
+            std::cout << "field_arithmetic_validation_test() - Unexpected table source! GF(2^" << power << ")" << std::endl;
+            return false;
+         }
+
+         std::vector<galois::field_symbol> symbol_list;
+
+         for (galois::field_symbol a = 0; a <= field_size; a += step)
+         {
+            symbol_list.push_back(a);
+         }
+
+         symbol_list.push_back(field_size);
+         symbol_list.push_back(field.alpha(field_size - 1));
+         symbol_list.push_back(field.alpha(field_size - 2));
+
+         for (galois::field_symbol i = 0; i < field_size; i += step)
+         {
+            const galois::field_symbol alpha_i = reference_field_exp(2,i,power,polynomial);
+
+            if ((field.alpha(i) != alpha_i) || (field.index(alpha_i) != i))
+            {
+               std::cout << "field_arithmetic_validation_test() - log/anti-log failure GF(2^" << power << ") i: " << i << std::endl;
+               return false;
+            }
+         }
+
+         for (std::size_t x = 0; x < symbol_list.size(); ++x)
+         {
+            const galois::field_symbol a = symbol_list[x];
+
+            if ((0 != a) && (reference_field_mul(a,field.inverse(a),power,polynomial) != 1))
+            {
+               std::cout << "field_arithmetic_validation_test() - inverse failure GF(2^" << power << ") symbol: " << a << std::endl;
+               return false;
+            }
+
+            for (std::size_t y = 0; y < symbol_list.size(); ++y)
+            {
+               const galois::field_symbol b = symbol_list[y];
+
+               if (
+                    (field.mul(a,b) != reference_field_mul(a,b,power,polynomial)) ||
+                    ((0 != b) && (reference_field_mul(field.div(a,b),b,power,polynomial) != a))
+                  )
+               {
+                  std::cout << "field_arithmetic_validation_test() - mul/div failure GF(2^" << power << ") symbols: " << a << "," << b << std::endl;
+                  return false;
+               }
+            }
+
+            if (0 == a)
+               continue;
+
+            /* Exponents over [-2 * field size, field size], the range every field supports. */
+            for (int n = -2 * field_size; n <= field_size; n += step)
+            {
+               const std::size_t exponent = static_cast<std::size_t>((n % field_size) + field_size) % field_size;
+
+               if (field.exp(a,n) != reference_field_exp(a,exponent,power,polynomial))
+               {
+                  std::cout << "field_arithmetic_validation_test() - exp failure GF(2^" << power << ") symbol: " << a << " power: " << n << std::endl;
+                  return false;
+               }
+            }
+
+            if (field.exp(a,field_size - 1) != reference_field_exp(a,field_size - 1,power,polynomial))
+            {
+               std::cout << "field_arithmetic_validation_test() - exp failure GF(2^" << power << ") symbol: " << a << " power: " << (field_size - 1) << std::endl;
+               return false;
+            }
+
+            /* Without the lookup tables any exponent is reduced, the product of log and exponent overflowing an int for m = 16. */
+            if (!field.lut_enabled())
+            {
+               const int extreme_exponent[] = { std::numeric_limits<int>::max(), std::numeric_limits<int>::min(), 3 * field_size + 1 };
+
+               for (std::size_t i = 0; i < sizeof(extreme_exponent) / sizeof(int); ++i)
+               {
+                  const int n = extreme_exponent[i];
+
+                  const std::size_t exponent = static_cast<std::size_t>((n % field_size) + field_size) % field_size;
+
+                  if (field.exp(a,n) != reference_field_exp(a,exponent,power,polynomial))
+                  {
+                     std::cout << "field_arithmetic_validation_test() - exp failure GF(2^" << power << ") symbol: " << a << " power: " << n << std::endl;
+                     return false;
+                  }
+               }
+            }
+         }
+
+         return true;
+      }
+
+      template <typename StaticField>
+      inline bool static_field_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         const StaticField static_field;
+
+         galois::field field(static_field.pwr(),prim_poly_size,prim_poly);
+
+         const galois::field_symbol field_size = static_cast<galois::field_symbol>(field.size());
+
+         for (galois::field_symbol a = 0; a <= field_size; ++a)
+         {
+            if (
+                 (static_field.alpha(a) != field.alpha(a)) ||
+                 ((0 != a) && (static_field.index  (a) != field.index  (a))) ||
+                 ((0 != a) && (static_field.inverse(a) != field.inverse(a)))
+               )
+            {
+               std::cout << "static_field_validation_test() - log/anti-log failure symbol: " << a << std::endl;
+               return false;
+            }
+
+            for (galois::field_symbol b = 0; b <= field_size; ++b)
+            {
+               if (
+                    (static_field.mul(a,b) != field.mul(a,b)) ||
+                    ((0 != b) && (static_field.div(a,b) != field.div(a,b)))
+                  )
+               {
+                  std::cout << "static_field_validation_test() - mul/div failure symbols: " << a << "," << b << std::endl;
+                  return false;
+               }
+
+               if ((0 != a) && (static_field.exp(a,b) != field.exp(a,b)))
+               {
+                  std::cout << "static_field_validation_test() - exp failure symbol: " << a << " power: " << b << std::endl;
+                  return false;
+               }
+            }
+         }
+
+         return true;
+      }
+
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length>
+      inline bool interleaved_encoder_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef typename encoder_type::block_type block_type;
+
+         const std::size_t data_length = code_length - fec_length;
+         const std::size_t row_count   = 300;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+
+         std::vector<unsigned char> stack(code_length * row_count);
+         unsigned char* column[code_length];
+
+         for (std::size_t i = 0; i < code_length; ++i)
+         {
+            column[i] = &stack[i * row_count];
+         }
+
+         for (std::size_t row = 0; row < row_count; ++row)
+         {
+            for (std::size_t i = 0; i < data_length; ++i)
+            {
+               column[i][row] = static_cast<unsigned char>((row * 31) ^ (i * 17) ^ (row >> 3));
+            }
+         }
+
+         if (!rs_encoder.encode_interleaved(column,row_count))
+         {
+            std::cout << "interleaved_encoder_validation_test() - Encoding failure!" << std::endl;
+            return false;
+         }
+
+         for (std::size_t row = 0; row < row_count; ++row)
+         {
+            block_type rs_block;
+
+            for (std::size_t i = 0; i < data_length; ++i)
+            {
+               rs_block.data[i] = column[i][row];
+            }
+
+            rs_encoder.encode(rs_block);
+
+            for (std::size_t i = 0; i < fec_length; ++i)
+            {
+               if (rs_block.fec(i) != column[data_length + i][row])
+               {
+                  std::cout << "interleaved_encoder_validation_test() - Parity mismatch! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") row: " << row << std::endl;
+                  return false;
+               }
+            }
+         }
+
+         return true;
+      }
+
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length>
+      inline bool interleaved_decoder_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef decoder<code_length,fec_length> decoder_type;
+
+         const std::size_t data_length = code_length - fec_length;
+         const std::size_t row_count   = 700;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+         const decoder_type rs_decoder(field,gen_poly_index);
+
+         std::vector<unsigned char> stack(code_length * row_count);
+         std::vector<unsigned char> syndrome_buffer(fec_length * row_count);
+         unsigned char* column  [code_length];
+         unsigned char* syndrome[fec_length ];
+
+         for (std::size_t i = 0; i < code_length; ++i)
+         {
+            column[i] = &stack[i * row_count];
+         }
+
+         for (std::size_t k = 0; k < fec_length; ++k)
+         {
+            syndrome[k] = &syndrome_buffer[k * row_count];
+         }
+
+         for (std::size_t row = 0; row < row_count; ++row)
+         {
+            for (std::size_t i = 0; i < data_length; ++i)
+            {
+               column[i][row] = static_cast<unsigned char>((row * 29) ^ (i * 11) ^ (row >> 2));
+            }
+         }
+
+         rs_encoder.encode_interleaved(column,row_count);
+
+         const std::vector<unsigned char> original_stack = stack;
+
+         if (rs_decoder.compute_syndromes_interleaved(column,row_count,syndrome))
+         {
+            std::cout << "interleaved_decoder_validation_test() - Non-zero syndrome for clean stack!" << std::endl;
+            return false;
+         }
+
+         /*
+            Corrupt every third codeword with a varying number of errors,
+            up to the correction capacity of the code.
+         */
+         for (std::size_t row = 0; row < row_count; row += 3)
+         {
+            const std::size_t error_count = 1 + (row % (fec_length >> 1));
+
+            for (std::size_t e = 0; e < error_count; ++e)
+            {
+               column[(row + e * 7) % code_length][row] ^= static_cast<unsigned char>(1 + ((row + e) % 255));
+            }
+         }
+
+         if (!rs_decoder.compute_syndromes_interleaved(column,row_count,syndrome))
+         {
+            std::cout << "interleaved_decoder_validation_test() - Zero syndrome for corrupted stack!" << std::endl;
+            return false;
+         }
+
+         if (!rs_decoder.decode_interleaved(column,row_count))
+         {
+            std::cout << "interleaved_decoder_validation_test() - Decoding failure!" << std::endl;
+            return false;
+         }
+
+         if (stack != original_stack)
+         {
+            std::cout << "interleaved_decoder_validation_test() - Error correcting failure! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ")" << std::endl;
+            return false;
+         }
+
+         return true;
+      }
+
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length>
+      inline bool erasure_channel_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef erasure_code_decoder<code_length,fec_length> decoder_type;
+         typedef block<code_length,fec_length> block_type;
+
+         const std::size_t data_length = code_length - fec_length;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+         const decoder_type rs_decoder(field,gen_poly_index);
+
+         block_type original_stack[code_length];
+         block_type block_stack   [code_length];
+
+         for (std::size_t round = 0; round < 4; ++round)
+         {
+            for (std::size_t row = 0; row < code_length; ++row)
+            {
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  block_stack[row][i] = static_cast<galois::field_symbol>((row * 7 + i * 3 + round) & 0xFF);
+               }
+
+               original_stack[row] = block_stack[row];
+            }
+
+            if (!erasure_channel_stack_encode<code_length,fec_length>(rs_encoder,block_stack))
+            {
+               return false;
+            }
+
+            erasure_locations_t missing_row_index;
+
+            for (std::size_t i = 0; i < fec_length; ++i)
+            {
+               const std::size_t missing_index = (round * 5 + i * 3) % data_length;
+
+               block_stack[missing_index].clear();
+               missing_row_index.push_back(missing_index);
+            }
+
+            if (!erasure_channel_stack_decode<code_length,fec_length>(rs_decoder,missing_row_index,block_stack))
+            {
+               std::cout << "erasure_channel_validation_test() - Decoding failure!" << std::endl;
+               return false;
+            }
+
+            for (std::size_t row = 0; row < code_length; ++row)
+            {
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  if (block_stack[row][i] != original_stack[row][i])
+                  {
+                     std::cout << "erasure_channel_validation_test() - Error correcting failure! row: " << row << std::endl;
+                     return false;
+                  }
+               }
+            }
+         }
+
+         return true;
+      }
+
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length>
+      inline bool error_correction_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef decoder<code_length,fec_length> decoder_type;
+         typedef block<code_length,fec_length> block_type;
+
+         const std::size_t data_length = code_length - fec_length;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+         const decoder_type rs_decoder(field,gen_poly_index);
+
+         typename decoder_type::workspace_type workspace;
+
+         block_type original_block;
+
+         for (std::size_t i = 0; i < data_length; ++i)
+         {
+            original_block.data[i] = static_cast<galois::field_symbol>((i * 37 + 11) & field.mask());
+         }
+
+         rs_encoder.encode(original_block);
+
+         const std::size_t position_step = 1 + (code_length / 61);
+
+         for (std::size_t error_count = 1; error_count <= (fec_length >> 1); ++error_count)
+         {
+            for (std::size_t start_position = 0; start_position < code_length; start_position += position_step)
+            {
+               block_type rs_block = original_block;
+
+               for (std::size_t e = 0; e < error_count; ++e)
+               {
+                  const std::size_t position = (start_position + e * (1 + (code_length / (fec_length + 1)))) % code_length;
+                  rs_block.data[position] ^= static_cast<galois::field_symbol>(1 + ((start_position + e * 29) % field.mask()));
+               }
+
+               if (!rs_decoder.decode(rs_block,workspace))
+               {
+                  std::cout << "error_correction_validation_test() - Decoding Failure! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") errors: " << error_count << std::endl;
+                  return false;
+               }
+               else if (!are_blocks_equivelent(rs_block,original_block))
+               {
+                  std::cout << "error_correction_validation_test() - Error Correcting Failure! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") errors: " << error_count << std::endl;
+                  return false;
+               }
+               else if (rs_block.errors_corrected != error_count)
+               {
+                  std::cout << "error_correction_validation_test() - Error In The Number Of Corrected Errors! Errors Corrected: " << rs_block.errors_corrected << std::endl;
+                  return false;
+               }
+            }
+         }
+
+         return true;
+      }
+
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length>
+      inline bool key_equation_solver_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef decoder<code_length,fec_length> decoder_type;
+         typedef block<code_length,fec_length> block_type;
+
+         const std::size_t data_length = code_length - fec_length;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+         const decoder_type bma_decoder(field,gen_poly_index,decoder_type::e_berlekamp_massey);
+         const decoder_type euclidean_decoder(field,gen_poly_index,decoder_type::e_euclidean);
+
+         typename decoder_type::workspace_type workspace;
+
+         std::vector<std::size_t> error_index;
+
+         generate_error_index(code_length,error_index,0);
+
+         block_type original_block;
+
+         for (std::size_t i = 0; i < data_length; ++i)
+         {
+            original_block.data[i] = static_cast<galois::field_symbol>((i * 53 + 7) & field.mask());
+         }
+
+         rs_encoder.encode(original_block);
+
+         /*
+            Every mix of erasures S and errors E within 2E + S <= fec_length,
+            at positions drawn from a permutation of the block, must be
+            corrected identically by both solvers.
+         */
+         for (std::size_t erasure_count = 0; erasure_count <= fec_length; ++erasure_count)
+         {
+            for (std::size_t error_count = 0; (2 * error_count + erasure_count) <= fec_length; ++error_count)
+            {
+               const std::size_t start = (erasure_count * 31 + error_count * 17) % code_length;
+
+               block_type rs_block = original_block;
+               erasure_locations_t erasure_list;
+
+               for (std::size_t i = 0; i < (erasure_count + error_count); ++i)
+               {
+                  const std::size_t position = error_index[(start + i) % code_length];
+
+                  rs_block.data[position] ^= static_cast<galois::field_symbol>(1 + ((start + i * 13) % field.mask()));
+
+                  if (i < erasure_count)
+                     erasure_list.push_back(position);
+               }
+
+               block_type bma_block       = rs_block;
+               block_type euclidean_block = rs_block;
+
+               const bool bma_result       = bma_decoder      .decode(bma_block      ,erasure_list,workspace);
+               const bool euclidean_result = euclidean_decoder.decode(euclidean_block,erasure_list,workspace);
+
+               if (!bma_result || !euclidean_result)
+               {
+                  std::cout << "key_equation_solver_validation_test() - Decoding Failure! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") "
+                            << "erasures: " << erasure_count << " errors: " << error_count << " bma: " << bma_result << " euclidean: " << euclidean_result << std::endl;
+                  return false;
+               }
+               else if (!are_blocks_equivelent(bma_block,original_block) || !are_blocks_equivelent(euclidean_block,original_block))
+               {
+                  std::cout << "key_equation_solver_validation_test() - Error Correcting Failure! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") "
+                            << "erasures: " << erasure_count << " errors: " << error_count << std::endl;
+                  return false;
+               }
+               else if (
+                         (bma_block.errors_corrected       != (erasure_count + error_count)) ||
+                         (euclidean_block.errors_corrected != (erasure_count + error_count))
+                       )
+               {
+                  std::cout << "key_equation_solver_validation_test() - Error In The Number Of Corrected Errors! Codec: RS(" << code_length << "," << data_length << "," << fec_length << ") "
+                            << "bma: " << bma_block.errors_corrected << " euclidean: " << euclidean_block.errors_corrected << std::endl;
+                  return false;
+               }
+            }
+         }
+
+         return true;
+      }
+
+      /* Bit at a time CRC-32C, the reference for the table and hardware versions. */
+      inline unsigned int crc32c_reference(const unsigned char* data, const std::size_t length)
+      {
+         unsigned int crc = 0xFFFFFFFF;
+
+         for (std::size_t i = 0; i < length; ++i)
+         {
+            crc ^= data[i];
+
+            for (std::size_t k = 0; k < 8; ++k)
+            {
+               crc = (crc & 1) ? ((crc >> 1) ^ schifra::details::crc32c_polynomial) : (crc >> 1);
+            }
+         }
+
+         return crc ^ 0xFFFFFFFF;
+      }
+
+      inline bool crc32c_validation_test()
+      {
+         const unsigned char check_data[] = "123456789";
+         const std::size_t   check_length = 9;
+         const unsigned int  check_crc    = 0xE3069283;
+
+         if ((crc32c_reference(check_data,check_length) != check_crc) || (crc32c::compute(check_data,check_length) != check_crc))
+         {
+            std::cout << "crc32c_validation_test() - Check value failure!" << std::endl;
+            return false;
+         }
+         else if ((schifra::details::crc32c_slicing8(0xFFFFFFFF,check_data,check_length) ^ 0xFFFFFFFF) != check_crc)
+         {
+            std::cout << "crc32c_validation_test() - Slicing-by-8 check value failure!" << std::endl;
+            return false;
+         }
+
+         /*
+            Lengths either side of the 12 KiB from which the SSE4.2 version
+            runs three streams, and over two blocks of them, at offsets
+            that leave the data unaligned.
+         */
+         const std::size_t length_list[] = { 1, 7, 8, 100, 4095, 12287, 12288, 12289, 24576 + 1000 + 5 };
+         const std::size_t offset_list[] = { 0, 1, 3 };
+
+         std::vector<unsigned char> buffer(24576 + 1000 + 5 + 3);
+
+         for (std::size_t i = 0; i < buffer.size(); ++i)
+         {
+            buffer[i] = static_cast<unsigned char>((i * 167) ^ (i >> 9) ^ 0x3C);
+         }
+
+         #ifdef SCHIFRA_CRCSIMD_X86
+         __builtin_cpu_init();
+
+         const bool sse42 = __builtin_cpu_supports("sse4.2");
+
+         if (sse42 && ((schifra::details::crc32c_sse42(0xFFFFFFFF,check_data,check_length) ^ 0xFFFFFFFF) != check_crc))
+         {
+            std::cout << "crc32c_validation_test() - SSE4.2 check value failure!" << std::endl;
+            return false;
+         }
+         #endif
+
+         for (std::size_t l = 0; l < sizeof(length_list) / sizeof(std::size_t); ++l)
+         {
+            for (std::size_t o = 0; o < sizeof(offset_list) / sizeof(std::size_t); ++o)
+            {
+               const unsigned char* data   = &buffer[offset_list[o]];
+               const std::size_t    length = length_list[l];
+               const unsigned int   crc    = crc32c_reference(data,length);
+
+               if ((schifra::details::crc32c_slicing8(0xFFFFFFFF,data,length) ^ 0xFFFFFFFF) != crc)
+               {
+                  std::cout << "crc32c_validation_test() - Slicing-by-8 failure length: " << length << " offset: " << offset_list[o] << std::endl;
+                  return false;
+               }
+
+               #ifdef SCHIFRA_CRCSIMD_X86
+               if (sse42 && ((schifra::details::crc32c_sse42(0xFFFFFFFF,data,length) ^ 0xFFFFFFFF) != crc))
+               {
+                  std::cout << "crc32c_validation_test() - SSE4.2 failure length: " << length << " offset: " << offset_list[o] << std::endl;
+                  return false;
+               }
+               #endif
+
+               for (std::size_t split = 0; split <= length; split += (length / 5) + 1)
+               {
+                  const unsigned int crc1 = crc32c::compute(data,split);
+                  const unsigned int crc2 = crc32c::compute(data + split,length - split);
+
+                  if (crc32c::combine(crc1,crc2,length - split) != crc)
+                  {
+                     std::cout << "crc32c_validation_test() - Combine failure length: " << length << " split: " << split << std::endl;
+                     return false;
+                  }
+               }
+            }
+         }
+
+         for (std::size_t split = 0; split <= check_length; ++split)
+         {
+            crc32c crc;
+
+            crc.update(check_data,split);
+            crc.update(check_data + split,check_length - split);
+
+            if (
+                 (crc.crc() != check_crc) ||
+                 (crc32c::combine(crc32c::compute(check_data,split),crc32c::compute(check_data + split,check_length - split),check_length - split) != check_crc)
+               )
+            {
+               std::cout << "crc32c_validation_test() - Check value failure split: " << split << std::endl;
+               return false;
+            }
+         }
+
+         return true;
+      }
+
+      /* Encode length bytes of data as a container part, as container_part_encoder does. */
+      template <std::size_t code_length, std::size_t fec_length>
+      inline bool encode_container_part(const encoder<code_length,fec_length>& rs_encoder,
+                                        const container_header& header,
+                                        const std::vector<unsigned char>& data,
+                                        const std::size_t length,
+                                        std::vector<unsigned char>& encoded,
+                                        container_entry& entry)
+      {
+         encoded.resize(encoded_part_size<code_length,fec_length>(length));
+
+         if (!encode_part(rs_encoder,&data[0],length,&encoded[0]))
+            return false;
+
+         entry.length        = encoded.size();
+         entry.checksum      = header.checksum(&encoded[0],encoded.size());
+         entry.data_checksum = header.checksum(&data[0],length);
+
+         if (header.has_segment_checksums())
+         {
+            compute_segment_checksums(header,&encoded[0],encoded.size(),entry.segment_checksum);
+         }
+
+         return true;
+      }
+
+      /*
+         Restore the given (possibly damaged) encoded part and require a
+         bit exact copy of the first length bytes of data, without any
+         failures and by way of the expected path, skipping the decoder
+         for an intact part and going through it otherwise.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      inline bool check_container_part_restore(const decoder<code_length,fec_length>& rs_decoder,
+                                               const container_header& header,
+                                               const container_entry& entry,
+                                               std::vector<unsigned char> encoded,
+                                               const std::vector<unsigned char>& data,
+                                               const std::size_t length,
+                                               const bool expected_intact)
+      {
+         std::vector<unsigned char> output(decoded_part_size<code_length,fec_length>(encoded.size()),0x00);
+
+         std::size_t failures = 0;
+         bool intact = !expected_intact;
+
+         if (!restore_container_part(rs_decoder,header,entry,&encoded[0],&output[0],failures,intact))
+         {
+            std::cout << "check_container_part_restore() - Restore failure! Version: " << header.version << " length: " << length << std::endl;
+            return false;
+         }
+         else if (intact != expected_intact)
+         {
+            std::cout << "check_container_part_restore() - Part taken as " << (intact ? "intact" : "damaged") << "! Version: " << header.version << " length: " << length << std::endl;
+            return false;
+         }
+         else if (0 != failures)
+         {
+            std::cout << "check_container_part_restore() - Decoding failures: " << failures << " Version: " << header.version << " length: " << length << std::endl;
+            return false;
+         }
+         else if ((output.size() != length) || !std::equal(output.begin(),output.end(),data.begin()))
+         {
+            std::cout << "check_container_part_restore() - Restored data mismatch! Version: " << header.version << " length: " << length << std::endl;
+            return false;
+         }
+
+         return true;
+      }
+
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length>
+      inline bool container_restore_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         const std::size_t data_length = code_length - fec_length;
+         const std::size_t part_rows   = 40;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder<code_length,fec_length> rs_encoder(field,generator_polynomial);
+         const decoder<code_length,fec_length> rs_decoder(field,gen_poly_index);
+
+         std::vector<unsigned char> data(part_rows * data_length);
+
+         for (std::size_t i = 0; i < data.size(); ++i)
+         {
+            data[i] = static_cast<unsigned char>((i * 31) ^ (i >> 5) ^ 0x5A);
+         }
+
+         /* A part of complete rows, and a shorter one ending in a partial row. */
+         const std::size_t length_list[] = { part_rows * data_length, ((part_rows - 3) * data_length) + (data_length / 3) };
+
+         const unsigned int version_list[] = { container_header::version_1, container_header::version_2, container_header::version_3 };
+
+         for (std::size_t v = 0; v < sizeof(version_list) / sizeof(unsigned int); ++v)
+         {
+            container_header header;
+
+            header.version      = version_list[v];
+            header.code_length  = code_length;
+            header.fec_length   = fec_length;
+            header.part_rows    = part_rows;
+            header.segment_rows = (container_header::version_3 == header.version) ? 8 : 0;
+
+            header.index_entry_size = static_cast<unsigned int>(header.expected_entry_size());
+
+            for (std::size_t l = 0; l < sizeof(length_list) / sizeof(std::size_t); ++l)
+            {
+               const std::size_t length = length_list[l];
+
+               std::vector<unsigned char> encoded;
+               container_entry entry;
+
+               if (!encode_container_part(rs_encoder,header,data,length,encoded,entry))
+               {
+                  std::cout << "container_restore_validation_test() - Encoding failure!" << std::endl;
+                  return false;
+               }
+
+               if (!check_container_part_restore(rs_decoder,header,entry,encoded,data,length,true))
+               {
+                  return false;
+               }
+
+               /*
+                  Damage every codeword, the tail one included, with fec_length / 2
+                  errors, the most the decoder can correct without erasures.
+               */
+               const std::size_t full_rows = encoded.size() / code_length;
+               const std::size_t tail_size = encoded.size() % code_length;
+
+               std::vector<unsigned char> damaged = encoded;
+
+               for (std::size_t j = 0; j < full_rows; ++j)
+               {
+                  for (std::size_t k = 0; k < (fec_length >> 1); ++k)
+                  {
+                     const std::size_t i = ((j * 7) + (k * 13)) % code_length;
+
+                     damaged[(i * full_rows) + j] ^= static_cast<unsigned char>(k + 1);
+                  }
+               }
+
+               for (std::size_t k = 0; (tail_size > 0) && (k < (fec_length >> 1)); ++k)
+               {
+                  damaged[(full_rows * code_length) + ((k * 5) % tail_size)] ^= static_cast<unsigned char>(k + 1);
+               }
+
+               if (!check_container_part_restore(rs_decoder,header,entry,damaged,data,length,false))
+               {
+                  return false;
+               }
+            }
+         }
+
+         return true;
+      }
+
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length>
+      inline bool container_segment_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         const std::size_t data_length  = code_length - fec_length;
+         const std::size_t part_rows    = 40;
+         const std::size_t segment_rows = 8;
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder<code_length,fec_length> rs_encoder(field,generator_polynomial);
+         const decoder<code_length,fec_length> rs_decoder(field,gen_poly_index);
+
+         container_header header;
+
+         header.version          = container_header::version_3;
+         header.code_length      = code_length;
+         header.fec_length       = fec_length;
+         header.part_rows        = part_rows;
+         header.segment_rows     = segment_rows;
+         header.index_entry_size = static_cast<unsigned int>(header.expected_entry_size());
+
+         /* Complete rows of which the last segment is short, then a partial row. */
+         const std::size_t length = ((part_rows - 3) * data_length) + (data_length / 3);
+
+         std::vector<unsigned char> data(length);
+
+         for (std::size_t i = 0; i < data.size(); ++i)
+         {
+            data[i] = static_cast<unsigned char>((i * 29) ^ (i >> 7) ^ 0xC3);
+         }
+
+         std::vector<unsigned char> encoded;
+         container_entry entry;
+
+         if (!encode_container_part(rs_encoder,header,data,length,encoded,entry))
+         {
+            std::cout << "container_segment_validation_test() - Encoding failure!" << std::endl;
+            return false;
+         }
+
+         const std::size_t full_rows = encoded.size() / code_length;
+         const std::size_t tail_size = encoded.size() % code_length;
+         const std::size_t first_row = segment_rows;
+
+         /*
+            Whole column segments lost in more columns than errors alone
+            could correct, but no more than fec_length, these can only be
+            repaired as erasures.
+         */
+         {
+            std::vector<unsigned char> damaged = encoded;
+
+            const std::size_t column_count = (3 * fec_length) / 4;
+
+            for (std::size_t k = 0; k < column_count; ++k)
+            {
+               const std::size_t i = (k * 11) % code_length;
+
+               for (std::size_t j = first_row; j < (first_row + segment_rows); ++j)
+               {
+                  damaged[(i * full_rows) + j] ^= static_cast<unsigned char>(j + 1);
+               }
+            }
+
+            if (!check_container_part_restore(rs_decoder,header,entry,damaged,data,length,false))
+            {
+               std::cout << "container_segment_validation_test() - Erasure decoding failure!" << std::endl;
+               return false;
+            }
+         }
+
+         /*
+            More failing column segments than fec_length, each with a single
+            error, spread so that no row exceeds fec_length / 2 errors. The
+            rows have to be decoded for errors alone.
+         */
+         {
+            std::vector<unsigned char> damaged = encoded;
+
+            const std::size_t column_count = fec_length + segment_rows;
+
+            for (std::size_t k = 0; k < column_count; ++k)
+            {
+               const std::size_t i = (k * 11) % code_length;
+               const std::size_t j = first_row + (k % segment_rows);
+
+               damaged[(i * full_rows) + j] ^= static_cast<unsigned char>(k + 1);
+            }
+
+            if (!check_container_part_restore(rs_decoder,header,entry,damaged,data,length,false))
+            {
+               std::cout << "container_segment_validation_test() - Errors only fallback failure!" << std::endl;
+               return false;
+            }
+         }
+
+         /*
+            Damage confined to the partial tail row, which is covered by no
+            segment checksum and so must be decoded whatever they say.
+         */
+         {
+            std::vector<unsigned char> damaged = encoded;
+
+            for (std::size_t k = 0; k < (fec_length >> 1); ++k)
+            {
+               damaged[(full_rows * code_length) + ((k * 5) % tail_size)] ^= static_cast<unsigned char>(k + 1);
+            }
+
+            if (!check_container_part_restore(rs_decoder,header,entry,damaged,data,length,false))
+            {
+               std::cout << "container_segment_validation_test() - Tail row decoding failure!" << std::endl;
+               return false;
+            }
+         }
+
+         return true;
+      }
+
+      /*
+         Apply random changes to an encoded file with file_update_encoder
+         and compare the result with a fresh file_encoder run over the
+         changed data. The file has a shorter last part that ends in a
+         partial row, and besides the random ranges, there are ranges
+         within a row, across rows and parts, and over that last part.
+         Finally an update whose old data is stale in its last part must
+         be refused without the encoded file being touched.
+      */
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length, std::size_t part_size_bytes>
+      inline bool file_update_encoder_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef file_encoder<part_size_bytes,code_length,fec_length> file_encoder_type;
+         typedef file_update_encoder<part_size_bytes,code_length,fec_length> file_update_encoder_type;
+
+         const std::size_t data_length     = code_length - fec_length;
+         const std::size_t part_input_size = (part_size_bytes / data_length) * data_length;
+         const std::size_t last_part       = 3 * part_input_size;
+         const std::size_t data_size       = last_part + (4 * data_length) + (data_length / 2);
+         const std::size_t update_rounds   = 8;
+         const std::size_t round_updates   = 8;
+
+         const std::string data_file_name      = "update_validation.dat";
+         const std::string encoded_file_name   = "update_validation.schifra";
+         const std::string reference_file_name = "update_validation_reference.schifra";
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+
+         unsigned int seed = 0x5EED1234;
+
+         std::string data(data_size,0x00);
+
+         for (std::size_t i = 0; i < data.size(); ++i)
+         {
+            seed    = (seed * 1103515245U) + 12345U;
+            data[i] = static_cast<char>((seed >> 16) & 0xFF);
+         }
+
+         fileio::write_file(data_file_name,data);
+
+         {
+            const file_encoder_type file_encoder(rs_encoder,data_file_name,encoded_file_name);
+         }
+
+         const std::size_t fixed_range[][2] =
+                           {
+                              { 5                           , 10                                  },
+                              { data_length - 3             , 7                                   },
+                              { part_input_size - 100       , 300                                 },
+                              { part_input_size / 2         , 2 * part_input_size                 },
+                              { last_part - 1               , 2                                   },
+                              { last_part + 10              , data_size - last_part - 10          },
+                              { data_size - 5               , 5                                   },
+                              { 0                           , data_size                           }
+                           };
+
+         const std::size_t fixed_range_count = sizeof(fixed_range) / sizeof(fixed_range[0]);
+
+         bool result = true;
+
+         for (std::size_t round = 0; result && (round < update_rounds); ++round)
+         {
+            for (std::size_t u = 0; result && (u < round_updates); ++u)
+            {
+               std::size_t offset = 0;
+               std::size_t length = 0;
+
+               if ((round * round_updates) + u < fixed_range_count)
+               {
+                  offset = fixed_range[(round * round_updates) + u][0];
+                  length = fixed_range[(round * round_updates) + u][1];
+               }
+               else
+               {
+                  seed   = (seed * 1103515245U) + 12345U;
+                  offset = (seed >> 8) % data_size;
+                  seed   = (seed * 1103515245U) + 12345U;
+                  length = 1 + ((seed >> 8) % std::min<std::size_t>(data_size - offset, (u & 1) ? data_length : 2 * part_input_size));
+               }
+
+               const std::string old_data = data.substr(offset,length);
+               std::string new_data = old_data;
+
+               /* Leave some bytes, and with them some rows, unchanged. */
+               for (std::size_t i = 0; i < new_data.size(); ++i)
+               {
+                  seed = (seed * 1103515245U) + 12345U;
+
+                  if (0 != ((seed >> 16) & 3))
+                  {
+                     new_data[i] = static_cast<char>((seed >> 20) & 0xFF);
+                  }
+               }
+
+               const file_update_encoder_type update_encoder(rs_encoder,
+                                                             encoded_file_name,
+                                                             offset,
+                                                             old_data.data(),
+                                                             new_data.data(),
+                                                             length);
+
+               if (!update_encoder.success())
+               {
+                  std::cout << "file_update_encoder_validation_test() - Update failure! offset: " << offset << " length: " << length << std::endl;
+                  result = false;
+               }
+
+               data.replace(offset,length,new_data);
+            }
+
+            if (!result)
+               break;
+
+            fileio::write_file(data_file_name,data);
+
+            const file_encoder_type file_encoder(rs_encoder,data_file_name,reference_file_name);
+
+            if (!fileio::files_identical(encoded_file_name,reference_file_name))
+            {
+               std::cout << "file_update_encoder_validation_test() - Updated file differs from fresh encoding! Round: " << round << std::endl;
+               result = false;
+            }
+         }
+
+         /*
+            Stale old data in the complete rows and in the partial row of
+            the last part, the earlier parts of the range being current.
+         */
+         const std::size_t stale_offset = part_input_size - 50;
+         const std::size_t stale_length = data_size - stale_offset;
+         const std::size_t stale_index[] = { last_part + data_length + 7 - stale_offset, stale_length - 1 };
+
+         for (std::size_t s = 0; result && (s < sizeof(stale_index) / sizeof(std::size_t)); ++s)
+         {
+            std::string encoded;
+            std::string after_update;
+
+            fileio::load_file(encoded_file_name,encoded);
+
+            std::string old_data = data.substr(stale_offset,stale_length);
+            const std::string new_data(stale_length,0x00);
+
+            old_data[stale_index[s]] = static_cast<char>(old_data[stale_index[s]] ^ 0x01);
+
+            const file_update_encoder_type update_encoder(rs_encoder,
+                                                          encoded_file_name,
+                                                          stale_offset,
+                                                          old_data.data(),
+                                                          new_data.data(),
+                                                          stale_length);
+
+            fileio::load_file(encoded_file_name,after_update);
+
+            if (update_encoder.success())
+            {
+               std::cout << "file_update_encoder_validation_test() - Stale old data accepted! index: " << stale_index[s] << std::endl;
+               result = false;
+            }
+            else if (encoded != after_update)
+            {
+               std::cout << "file_update_encoder_validation_test() - Encoded file changed by refused update! index: " << stale_index[s] << std::endl;
+               result = false;
+            }
+         }
+
+         std::remove(data_file_name     .c_str());
+         std::remove(encoded_file_name  .c_str());
+         std::remove(reference_file_name.c_str());
+
+         return result;
+      }
+
+      /*
+         Push input through a stream codec in chunks cycling through the
+         sizes in chunk_size, pulling its output in chunks of the sizes
+         taken in reverse order.
+      */
+      template <typename Processor>
+      inline bool run_stream_codec(stream_codec<Processor>& codec,
+                                   const std::string& input,
+                                   const std::size_t chunk_size[],
+                                   const std::size_t chunk_size_count,
+                                   std::string& output)
+      {
+         std::vector<char> buffer(*std::max_element(chunk_size, chunk_size + chunk_size_count));
+
+         std::size_t offset = 0;
+         std::size_t chunk  = 0;
+
+         output.clear();
+
+         while (!codec.done() && !codec.failed())
+         {
+            const std::size_t write_size = std::min(chunk_size[chunk % chunk_size_count], input.size() - offset);
+            const std::size_t read_size  = chunk_size[chunk_size_count - 1 - (chunk % chunk_size_count)];
+
+            ++chunk;
+
+            offset += codec.write(input.data() + offset, write_size);
+
+            if (offset == input.size())
+            {
+               codec.finish();
+            }
+
+            std::size_t length = 0;
+
+            while ((length = codec.read(&buffer[0], read_size)) > 0)
+            {
+               output.append(&buffer[0], length);
+            }
+         }
+
+         return !codec.failed();
+      }
+
+      /*
+         stream_encoder and stream_decoder fed and drained in odd sized
+         chunks, and through process_stream with an odd buffer size, must
+         produce exactly the output of file_encoder and file_decoder.
+         Covers an empty input, inputs ending on a part boundary and ones
+         ending in a partial row, the encoded data carrying a correctable
+         number of errors in every row. process_stream must also report a
+         failed input stream rather than end the output there.
+      */
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length, std::size_t part_size_bytes>
+      inline bool stream_codec_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[])
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef decoder<code_length,fec_length> decoder_type;
+         typedef file_encoder  <part_size_bytes,code_length,fec_length> file_encoder_type;
+         typedef file_decoder  <part_size_bytes,code_length,fec_length> file_decoder_type;
+         typedef stream_encoder<part_size_bytes,code_length,fec_length> stream_encoder_type;
+         typedef stream_decoder<part_size_bytes,code_length,fec_length> stream_decoder_type;
+
+         const std::size_t data_length     = code_length - fec_length;
+         const std::size_t part_input_size = (part_size_bytes / data_length) * data_length;
+         const std::size_t row_errors      = fec_length / 2;
+
+         const std::size_t data_size[] =
+                           {
+                              0,
+                              1,
+                              data_length,
+                              part_input_size,
+                              2 * part_input_size,
+                              2 * part_input_size + (3 * data_length) + (data_length / 2),
+                              3 * part_input_size - 1
+                           };
+
+         const std::size_t chunk_size[] = { 1, 7, 509, 3 * part_size_bytes + 13, 97 };
+         const std::size_t chunk_size_count = sizeof(chunk_size) / sizeof(std::size_t);
+
+         const std::string data_file_name    = "stream_validation.dat";
+         const std::string encoded_file_name = "stream_validation.schifra";
+         const std::string decoded_file_name = "stream_validation_decoded.dat";
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+         const decoder_type rs_decoder(field,gen_poly_index);
+
+         unsigned int seed = 0x5EED4321;
+
+         bool result = true;
+
+         for (std::size_t d = 0; result && (d < sizeof(data_size) / sizeof(std::size_t)); ++d)
+         {
+            std::string data(data_size[d],0x00);
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+               seed    = (seed * 1103515245U) + 12345U;
+               data[i] = static_cast<char>((seed >> 16) & 0xFF);
+            }
+
+            /* The file codecs refuse an empty input, the streams produce nothing for it. */
+            std::string file_encoded;
+            std::string file_decoded;
+
+            if (!data.empty())
+            {
+               fileio::write_file(data_file_name,data);
+
+               const file_encoder_type file_encoder(rs_encoder,data_file_name,encoded_file_name);
+
+               fileio::load_file(encoded_file_name,file_encoded);
+            }
+
+            std::string stream_encoded;
+
+            stream_encoder_type encoder_stream(rs_encoder);
+
+            if (!run_stream_codec(encoder_stream,data,chunk_size,chunk_size_count,stream_encoded) || (stream_encoded != file_encoded))
+            {
+               std::cout << "stream_codec_validation_test() - Stream encoding differs from file_encoder! size: " << data.size() << std::endl;
+               result = false;
+               break;
+            }
+
+            std::istringstream in_stream(data);
+            std::ostringstream out_stream;
+
+            stream_encoder_type process_encoder(rs_encoder);
+
+            if (!process_stream(process_encoder,in_stream,out_stream,3 * code_length + 1) || (out_stream.str() != file_encoded))
+            {
+               std::cout << "stream_codec_validation_test() - process_stream encoding differs from file_encoder! size: " << data.size() << std::endl;
+               result = false;
+               break;
+            }
+
+            /*
+               Corrupt row_errors distinct symbols of every row, the tail
+               row included. Within a part the complete rows are stored
+               transposed, each symbol index forming a run of full_rows
+               bytes, followed by the tail row as is.
+            */
+            std::string corrupted = file_encoded;
+
+            for (std::size_t input_offset = 0, output_offset = 0; input_offset < data.size(); input_offset += part_input_size)
+            {
+               const std::size_t length    = std::min(part_input_size, data.size() - input_offset);
+               const std::size_t full_rows = length / data_length;
+               const std::size_t tail_size = (length % data_length) ? (length % data_length) + fec_length : 0;
+
+               for (std::size_t e = 0; e < row_errors; ++e)
+               {
+                  const std::size_t symbol = (e * code_length) / row_errors;
+
+                  for (std::size_t j = 0; j < full_rows; ++j)
+                  {
+                     corrupted[output_offset + (symbol * full_rows) + j] ^= static_cast<char>(1 + e);
+                  }
+
+                  if (tail_size)
+                  {
+                     corrupted[output_offset + (full_rows * code_length) + ((e * tail_size) / row_errors)] ^= static_cast<char>(1 + e);
+                  }
+               }
+
+               output_offset += (full_rows * code_length) + tail_size;
+            }
+
+            if (!corrupted.empty())
+            {
+               fileio::write_file(encoded_file_name,corrupted);
+
+               const file_decoder_type file_decoder(rs_decoder,encoded_file_name,decoded_file_name);
+
+               fileio::load_file(decoded_file_name,file_decoded);
+            }
+
+            std::string stream_decoded;
+
+            stream_decoder_type decoder_stream(rs_decoder);
+
+            if (!run_stream_codec(decoder_stream,corrupted,chunk_size,chunk_size_count,stream_decoded) || (stream_decoded != file_decoded))
+            {
+               std::cout << "stream_codec_validation_test() - Stream decoding differs from file_decoder! size: " << data.size() << std::endl;
+               result = false;
+            }
+            else if ((stream_decoded != data) || (0 != decoder_stream.failure_count()))
+            {
+               std::cout << "stream_codec_validation_test() - Stream decoding failed to correct errors! size: " << data.size() << std::endl;
+               result = false;
+            }
+         }
+
+         if (result)
+         {
+            std::istream       bad_stream(0);
+            std::ostringstream out_stream;
+
+            stream_encoder_type process_encoder(rs_encoder);
+
+            if (process_stream(process_encoder,bad_stream,out_stream))
+            {
+               std::cout << "stream_codec_validation_test() - process_stream accepted a failed input stream!" << std::endl;
+               result = false;
+            }
+         }
+
+         std::remove(data_file_name   .c_str());
+         std::remove(encoded_file_name.c_str());
+         std::remove(decoded_file_name.c_str());
+
+         return result;
+      }
+
+      inline bool same_part_health(const part_health& health0, const part_health& health1)
+      {
+         return (health0.rows        == health1.rows       ) &&
+                (health0.dirty_rows  == health1.dirty_rows ) &&
+                (health0.error_count == health1.error_count) &&
+                (health0.failures    == health1.failures   ) ;
+      }
+
+      /*
+         Encode parts as the file codecs do, inject a known number of
+         errors into every row, the tail row included, and make one row
+         uncorrectable, then check that check_part, check_interleaved and
+         file_scrubber report exactly the dirty rows, errors and failures
+         injected. interleaved selects whether the decoder is expected to
+         take the interleaved path or the scalar fallback of check_part.
+      */
+      template <std::size_t field_descriptor, std::size_t gen_poly_index, std::size_t code_length, std::size_t fec_length, std::size_t part_size_bytes>
+      inline bool check_part_validation_test(const std::size_t prim_poly_size,const unsigned int prim_poly[], const bool interleaved)
+      {
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef decoder<code_length,fec_length> decoder_type;
+         typedef typename decoder_type::block_type block_type;
+         typedef file_scrubber<part_size_bytes,code_length,fec_length> file_scrubber_type;
+
+         const std::size_t data_length = code_length - fec_length;
+         const std::size_t part_data   = (part_size_bytes / data_length) * data_length;
+         const std::size_t data_size   = (2 * part_data) + (3 * data_length) + (data_length / 2);
+         const std::size_t max_errors  = fec_length / 2;
+
+         const std::string encoded_file_name = "check_validation.schifra";
+
+         galois::field field(field_descriptor,prim_poly_size,prim_poly);
+         galois::field_polynomial generator_polynomial(field);
+
+         if (!make_sequential_root_generator_polynomial(field,gen_poly_index,fec_length,generator_polynomial))
+         {
+            return false;
+         }
+
+         const encoder_type rs_encoder(field,generator_polynomial);
+         const decoder_type rs_decoder(field,gen_poly_index);
+
+         if (rs_decoder.supports_interleaved() != interleaved)
+         {
+            std::cout << "check_part_validation_test() - Unexpected interleaved support!" << std::endl;
+            return false;
+         }
+
+         const std::size_t field_size = field.size();
+
+         unsigned int seed = 0x5EED0C4E;
+
+         std::vector<unsigned char> data(data_size);
+
+         for (std::size_t i = 0; i < data.size(); ++i)
+         {
+            seed    = (seed * 1103515245U) + 12345U;
+            data[i] = static_cast<unsigned char>((seed >> 16) % (field_size + 1));
+         }
+
+         std::vector<unsigned char> encoded;
+         std::vector<std::size_t>   part_offset;
+
+         for (std::size_t offset = 0; offset < data.size(); offset += part_data)
+         {
+            const std::size_t length = std::min(part_data, data.size() - offset);
+
+            part_offset.push_back(encoded.size());
+            encoded.resize(encoded.size() + encoded_part_size<code_length,fec_length>(length));
+
+            if (!encode_part(rs_encoder, &data[offset], length, &encoded[part_offset.back()]))
+            {
+               std::cout << "check_part_validation_test() - Part encoding failure!" << std::endl;
+               return false;
+            }
+         }
+
+         part_offset.push_back(encoded.size());
+
+         const std::size_t part_count = part_offset.size() - 1;
+
+         {
+            fileio::write_file(encoded_file_name,std::string(encoded.begin(),encoded.end()));
+
+            const file_scrubber_type scrubber(rs_decoder,encoded_file_name);
+
+            if (!scrubber.healthy() || (0 != scrubber.dirty_row_count()) || (0 != scrubber.error_count()))
+            {
+               std::cout << "check_part_validation_test() - Clean file reported as dirty!" << std::endl;
+               std::remove(encoded_file_name.c_str());
+               return false;
+            }
+         }
+
+         /*
+            Expected health of the complete rows of every part, which are
+            what check_interleaved covers, and of the whole of every part.
+         */
+         std::vector<part_health> expected_full(part_count);
+         std::vector<part_health> expected_part(part_count);
+
+         bool uncorrectable_injected = false;
+
+         for (std::size_t p = 0; p < part_count; ++p)
+         {
+            unsigned char* part = &encoded[part_offset[p]];
+
+            const std::size_t length    = part_offset[p + 1] - part_offset[p];
+            const std::size_t full_rows = length / code_length;
+            const std::size_t remaining = length % code_length;
+
+            expected_full[p].rows = full_rows;
+            expected_part[p].rows = full_rows + ((remaining > 0) ? 1 : 0);
+
+            for (std::size_t j = 0; j < full_rows; ++j)
+            {
+               if ((1 == p) && (j == full_rows / 2))
+               {
+                  /*
+                     More errors than the code corrects, in a pattern the
+                     decoder is confirmed to fail on, as some patterns are
+                     miscorrected into another codeword instead.
+                  */
+                  block_type block;
+
+                  for (std::size_t i = 0; i < code_length; ++i)
+                  {
+                     block[i] = part[(i * full_rows) + j];
+                  }
+
+                  for (std::size_t attempt = 0; !uncorrectable_injected && (attempt < 64); ++attempt)
+                  {
+                     block_type corrupted_block = block;
+
+                     seed = (seed * 1103515245U) + 12345U;
+
+                     const std::size_t start = (seed >> 8) % code_length;
+
+                     for (std::size_t e = 0; e <= max_errors; ++e)
+                     {
+                        seed = (seed * 1103515245U) + 12345U;
+                        corrupted_block[(start + e) % code_length] ^= 1 + ((seed >> 16) % field_size);
+                     }
+
+                     if (rs_decoder.decode(corrupted_block))
+                        continue;
+
+                     for (std::size_t e = 0; e <= max_errors; ++e)
+                     {
+                        const std::size_t i = (start + e) % code_length;
+
+                        part[(i * full_rows) + j] ^= static_cast<unsigned char>(block[i] ^ corrupted_block[i]);
+                     }
+
+                     uncorrectable_injected = true;
+                  }
+
+                  ++expected_full[p].dirty_rows;
+                  ++expected_full[p].failures;
+
+                  continue;
+               }
+
+               const std::size_t errors = (j + p) % (max_errors + 1);
+
+               for (std::size_t e = 0; e < errors; ++e)
+               {
+                  const std::size_t i = (((e * code_length) / errors) + j) % code_length;
+
+                  seed = (seed * 1103515245U) + 12345U;
+                  part[(i * full_rows) + j] ^= static_cast<unsigned char>(1 + ((seed >> 16) % field_size));
+               }
+
+               if (errors > 0)
+               {
+                  ++expected_full[p].dirty_rows;
+                  expected_full[p].error_count += errors;
+               }
+            }
+
+            expected_part[p].dirty_rows  = expected_full[p].dirty_rows;
+            expected_part[p].error_count = expected_full[p].error_count;
+            expected_part[p].failures    = expected_full[p].failures;
+
+            if (remaining > 0)
+            {
+               unsigned char* tail = part + (full_rows * code_length);
+
+               for (std::size_t e = 0; e < max_errors; ++e)
+               {
+                  seed = (seed * 1103515245U) + 12345U;
+                  tail[(e * remaining) / max_errors] ^= static_cast<unsigned char>(1 + ((seed >> 16) % field_size));
+               }
+
+               ++expected_part[p].dirty_rows;
+               expected_part[p].error_count += max_errors;
+            }
+         }
+
+         if (!uncorrectable_injected)
+         {
+            std::cout << "check_part_validation_test() - No uncorrectable error pattern found!" << std::endl;
+            return false;
+         }
+
+         bool result = true;
+
+         for (std::size_t p = 0; result && (p < part_count); ++p)
+         {
+            const unsigned char* part = &encoded[part_offset[p]];
+
+            const std::size_t length = part_offset[p + 1] - part_offset[p];
+
+            part_health health;
+
+            if (!check_part(rs_decoder, part, length, health) || !same_part_health(health,expected_part[p]))
+            {
+               std::cout << "check_part_validation_test() - check_part mismatch! part: " << p
+                         << " dirty rows: " << health.dirty_rows  << "/" << expected_part[p].dirty_rows
+                         << " errors: "     << health.error_count << "/" << expected_part[p].error_count
+                         << " failures: "   << health.failures    << "/" << expected_part[p].failures << std::endl;
+               result = false;
+               break;
+            }
+
+            const std::size_t full_rows = expected_full[p].rows;
+
+            const unsigned char* column[code_length];
+
+            for (std::size_t i = 0; i < code_length; ++i)
+            {
+               column[i] = part + (i * full_rows);
+            }
+
+            part_health full;
+
+            full.rows = full_rows;
+
+            const bool clean = rs_decoder.check_interleaved(column, full_rows, full.dirty_rows, full.error_count, full.failures);
+
+            if (interleaved)
+            {
+               if ((clean != (0 == expected_full[p].failures)) || !same_part_health(full,expected_full[p]))
+               {
+                  std::cout << "check_part_validation_test() - check_interleaved mismatch! part: " << p << std::endl;
+                  result = false;
+               }
+            }
+            else if (clean || (0 != full.dirty_rows) || (0 != full.error_count) || (0 != full.failures))
+            {
+               std::cout << "check_part_validation_test() - check_interleaved ran without interleaved support!" << std::endl;
+               result = false;
+            }
+         }
+
+         if (result)
+         {
+            fileio::write_file(encoded_file_name,std::string(encoded.begin(),encoded.end()));
+
+            const file_scrubber_type scrubber(rs_decoder,encoded_file_name);
+
+            part_health total;
+
+            for (std::size_t p = 0; p < part_count; ++p)
+            {
+               total.dirty_rows  += expected_part[p].dirty_rows;
+               total.error_count += expected_part[p].error_count;
+               total.failures    += expected_part[p].failures;
+            }
+
+            if (
+                 !scrubber.success()                                      ||
+                  scrubber.healthy()                                      ||
+                 (scrubber.dirty_row_count() != total.dirty_rows )        ||
+                 (scrubber.error_count    () != total.error_count)        ||
+                 (scrubber.failure_count  () != total.failures   )        ||
+                 (scrubber.part_health_list().size() != part_count)
+               )
+            {
+               std::cout << "check_part_validation_test() - file_scrubber totals mismatch!" << std::endl;
+               result = false;
+            }
+
+            for (std::size_t p = 0; result && (p < part_count); ++p)
+            {
+               if (!same_part_health(scrubber.part_health_list()[p],expected_part[p]))
+               {
+                  std::cout << "check_part_validation_test() - file_scrubber part mismatch! part: " << p << std::endl;
+                  result = false;
+               }
+            }
+         }
+
+         std::remove(encoded_file_name.c_str());
+
+         return result;
+      }
+
+      inline bool codec_validation_test02()
+      {
+         return field_arithmetic_validation_test( 4,galois::primitive_polynomial_size01,galois::primitive_polynomial01,false,1) &&
+                field_arithmetic_validation_test( 8,galois::primitive_polynomial_size05,galois::primitive_polynomial05,true ,1) &&
+                field_arithmetic_validation_test( 8,galois::primitive_polynomial_size06,galois::primitive_polynomial06,true ,1) &&
+                field_arithmetic_validation_test(10,galois::primitive_polynomial_size08,galois::primitive_polynomial08,false,3) &&
+                field_arithmetic_validation_test(16,galois::primitive_polynomial_size14,galois::primitive_polynomial14,false,257) &&
+                static_field_validation_test<galois::static_field01>(galois::primitive_polynomial_size01,galois::primitive_polynomial01) &&
+                static_field_validation_test<galois::static_field05>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                static_field_validation_test<galois::static_field06>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                region_multiplier_validation_test(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                region_multiplier_validation_test(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                interleaved_encoder_validation_test<8,120,255,  2>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                interleaved_encoder_validation_test<8,120,255, 16>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                interleaved_encoder_validation_test<8,120,255, 32>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                interleaved_encoder_validation_test<8,  1,255, 64>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                interleaved_encoder_validation_test<8,  1,255,200>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) ;
+      }
+
+      inline bool codec_validation_test03()
+      {
+         return interleaved_decoder_validation_test<8,120,255,  2>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                interleaved_decoder_validation_test<8,120,255, 16>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                interleaved_decoder_validation_test<8,120,255, 32>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                interleaved_decoder_validation_test<8,  1,255, 64>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                erasure_channel_validation_test    <8,120,255, 20>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                erasure_channel_validation_test    <8,  1,255, 64>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) ;
+      }
+
+      inline bool codec_validation_test04()
+      {
+         return error_correction_validation_test< 4,0,   15,  6>(galois::primitive_polynomial_size01,galois::primitive_polynomial01) &&
+                error_correction_validation_test< 8,1,  255, 20>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                error_correction_validation_test< 8,1,  255,128>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                error_correction_validation_test<10,0, 1023, 32>(galois::primitive_polynomial_size08,galois::primitive_polynomial08) &&
+                error_correction_validation_test<16,0,65535, 32>(galois::primitive_polynomial_size14,galois::primitive_polynomial14) &&
+                key_equation_solver_validation_test< 4,0,  15,  6>(galois::primitive_polynomial_size01,galois::primitive_polynomial01) &&
+                key_equation_solver_validation_test< 8,120,255,  2>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                key_equation_solver_validation_test< 8,120,255, 32>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                key_equation_solver_validation_test< 8,  1,255,128>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) ;
+      }
+
+      inline bool codec_validation_test05()
+      {
+         return crc32c_validation_test() &&
+                container_restore_validation_test<8,120,255, 32>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                container_restore_validation_test<8,  1,255, 64>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                container_segment_validation_test<8,120,255, 32>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                container_segment_validation_test<8,  1,255, 64>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                file_update_encoder_validation_test<8,120,255, 32,4096>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                file_update_encoder_validation_test<8,  1,255, 64,2048>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                stream_codec_validation_test       <8,120,255, 32,4096>(galois::primitive_polynomial_size06,galois::primitive_polynomial06) &&
+                stream_codec_validation_test       <8,  1,255, 64,2048>(galois::primitive_polynomial_size05,galois::primitive_polynomial05) &&
+                check_part_validation_test         <8,120,255, 32,65536>(galois::primitive_polynomial_size06,galois::primitive_polynomial06,true ) &&
+                check_part_validation_test         <8,  1,255, 64, 2048>(galois::primitive_polynomial_size05,galois::primitive_polynomial05,true ) &&
+                check_part_validation_test         <4,  0, 15,  6,  200>(galois::primitive_polynomial_size01,galois::primitive_polynomial01,false) ;
       }
 
    } // namespace reed_solomon
@@ -0,0 +1,568 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_CONTAINER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_CONTAINER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "schifra_crc.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Self describing container for files encoded in the file codec
+         format. All fields are little-endian.
+
+            header (64 bytes)
+               0  magic "SCHIFRA\x1A"
+               8  format version (u16), header size (u16)
+              12  code length, fec length, rows per part (u32 each)
+              24  checksum type, index entry size (u32 each)
+              32  original file size, part count, index offset (u64 each)
+              56  header checksum (u32), versions 1 and 2
+              56  rows per column segment (u32), version 3 onwards
+              60  header checksum (u32), version 3 onwards
+
+            encoded parts, back to back
+
+            index
+               per part: offset (u64), length (u64), checksum (u32),
+                         data checksum (u32, version 2 onwards),
+                         column segment checksums (u32 each, version 3)
+               index checksum (u32)
+
+         All checksums are of the type given in the header, CRC-32C for
+         new containers. The header checksum covers all of the bytes
+         before it, 56 or 60 by version, and the index checksum all of
+         the index entries. The part
+         checksum is taken over the encoded part as stored, so damage to
+         a part can be detected without decoding it. The data checksum is taken over
+         the original data of the part, which lets a restore skip the
+         decoding of parts that are intact and confirm the result of
+         those that were not.
+
+         Version 3 further divides the columns of the complete rows of a
+         part into segments of a fixed number of rows, and checksums each
+         column segment, segment by segment and column by column within
+         a segment. A segment whose checksum fails marks its column as an
+         erasure in each of the segment's rows, so that a damaged part can
+         be repaired of up to fec length lost symbols per row rather than
+         half as many errors. Segments past the last complete row of a
+         shorter final part have a checksum of zero.
+      */
+
+      namespace details
+      {
+         inline void store_le(unsigned char* buffer, const unsigned long long value, const std::size_t bytes)
+         {
+            for (std::size_t i = 0; i < bytes; ++i)
+            {
+               buffer[i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+            }
+         }
+
+         inline unsigned long long load_le(const unsigned char* buffer, const std::size_t bytes)
+         {
+            unsigned long long value = 0;
+
+            for (std::size_t i = 0; i < bytes; ++i)
+            {
+               value |= static_cast<unsigned long long>(buffer[i]) << (8 * i);
+            }
+
+            return value;
+         }
+      } // namespace details
+
+      enum container_checksum_type
+      {
+         e_container_checksum_crc32  = 1,
+         e_container_checksum_crc32c = 2
+      };
+
+      inline bool valid_container_checksum_type(const unsigned int type)
+      {
+         return (e_container_checksum_crc32  == type) ||
+                (e_container_checksum_crc32c == type) ;
+      }
+
+      /* CRC-32 (IEEE 802.3) or CRC-32C of the given bytes. */
+      inline unsigned int container_checksum(const unsigned int type, const unsigned char* data, const std::size_t length)
+      {
+         if (e_container_checksum_crc32c == type)
+            return crc32c::compute(data, length);
+
+         crc32 crc(0xEDB88320, 0xFFFFFFFF);
+
+         crc.update(data, length);
+
+         return static_cast<unsigned int>((crc.crc() ^ 0xFFFFFFFF) & 0xFFFFFFFF);
+      }
+
+      struct container_header
+      {
+         enum { size       = 64 };
+         enum { version_1  =  1 };
+         enum { version_2  =  2 };
+         enum { version_3  =  3 };
+
+         enum { entry_size_v1 = 20 };
+         enum { entry_size_v2 = 24 };
+
+         container_header()
+         : version(version_2),
+           code_length(0),
+           fec_length(0),
+           part_rows(0),
+           checksum_type(e_container_checksum_crc32c),
+           index_entry_size(entry_size_v2),
+           file_size(0),
+           part_count(0),
+           index_offset(0),
+           segment_rows(0)
+         {}
+
+         inline std::size_t input_part_size() const
+         {
+            return part_rows * (code_length - fec_length);
+         }
+
+         inline std::size_t encoded_part_size() const
+         {
+            return part_rows * code_length;
+         }
+
+         /* Checksum of the given bytes of the type used by this container. */
+         inline unsigned int checksum(const unsigned char* data, const std::size_t length) const
+         {
+            return container_checksum(checksum_type, data, length);
+         }
+
+         inline bool has_data_checksum() const
+         {
+            return (version >= version_2);
+         }
+
+         inline bool has_segment_checksums() const
+         {
+            return (version >= version_3);
+         }
+
+         /* Number of column segments covering the complete rows of a part. */
+         inline std::size_t segment_count() const
+         {
+            return has_segment_checksums() ? ((part_rows + segment_rows - 1) / segment_rows) : 0;
+         }
+
+         inline std::size_t expected_entry_size() const
+         {
+            switch (version)
+            {
+               case version_1 : return entry_size_v1;
+               case version_2 : return entry_size_v2;
+               case version_3 : return entry_size_v2 + (4 * code_length * segment_count());
+               default        : return 0;
+            }
+         }
+
+         /* Offset of the header checksum, which covers every byte before it. */
+         inline std::size_t checksum_offset() const
+         {
+            return (version >= version_3) ? 60 : 56;
+         }
+
+         inline void write(unsigned char buffer[size]) const
+         {
+            std::memset(buffer, 0x00, size);
+            std::memcpy(buffer, "SCHIFRA\x1A", 8);
+
+            details::store_le(buffer +  8, version          , 2);
+            details::store_le(buffer + 10, size             , 2);
+            details::store_le(buffer + 12, code_length      , 4);
+            details::store_le(buffer + 16, fec_length       , 4);
+            details::store_le(buffer + 20, part_rows        , 4);
+            details::store_le(buffer + 24, checksum_type    , 4);
+            details::store_le(buffer + 28, index_entry_size , 4);
+            details::store_le(buffer + 32, file_size        , 8);
+            details::store_le(buffer + 40, part_count       , 8);
+            details::store_le(buffer + 48, index_offset     , 8);
+
+            if (has_segment_checksums())
+            {
+               details::store_le(buffer + 56, segment_rows  , 4);
+            }
+
+            details::store_le(buffer + checksum_offset(), checksum(buffer, checksum_offset()), 4);
+         }
+
+         inline bool read(const unsigned char buffer[size])
+         {
+            version       = static_cast<unsigned int>(details::load_le(buffer +  8, 2));
+            checksum_type = static_cast<unsigned int>(details::load_le(buffer + 24, 4));
+
+            if (0 != std::memcmp(buffer, "SCHIFRA\x1A", 8))
+               return false;
+            else if (!valid_container_checksum_type(checksum_type))
+               return false;
+            else if (details::load_le(buffer + checksum_offset(), 4) != checksum(buffer, checksum_offset()))
+               return false;
+
+            code_length      = static_cast<unsigned int>(details::load_le(buffer + 12, 4));
+            fec_length       = static_cast<unsigned int>(details::load_le(buffer + 16, 4));
+            part_rows        = static_cast<unsigned int>(details::load_le(buffer + 20, 4));
+            index_entry_size = static_cast<unsigned int>(details::load_le(buffer + 28, 4));
+            file_size        = static_cast<std::size_t >(details::load_le(buffer + 32, 8));
+            part_count       = static_cast<std::size_t >(details::load_le(buffer + 40, 8));
+            index_offset     = static_cast<std::size_t >(details::load_le(buffer + 48, 8));
+            segment_rows     = has_segment_checksums() ? static_cast<unsigned int>(details::load_le(buffer + 56, 4)) : 0;
+
+            if (
+                 (size != details::load_le(buffer + 10, 2)) ||
+                 (code_length <= fec_length) || (0 == part_rows)
+               )
+               return false;
+            else if (has_segment_checksums() && (0 == segment_rows))
+               return false;
+
+            return (0 != index_entry_size) && (expected_entry_size() == index_entry_size);
+         }
+
+         unsigned int version;
+         unsigned int code_length;
+         unsigned int fec_length;
+         unsigned int part_rows;
+         unsigned int checksum_type;
+         unsigned int index_entry_size;
+         std::size_t  file_size;
+         std::size_t  part_count;
+         std::size_t  index_offset;
+         unsigned int segment_rows;
+      };
+
+      struct container_entry
+      {
+         container_entry()
+         : offset(0),
+           length(0),
+           checksum(0),
+           data_checksum(0)
+         {}
+
+         std::size_t  offset;
+         std::size_t  length;
+         unsigned int checksum;
+         unsigned int data_checksum;
+         std::vector<unsigned int> segment_checksum;
+      };
+
+      /*
+         Checksums of the column segments of an encoded part of length
+         bytes, see the version 3 layout above.
+      */
+      inline void compute_segment_checksums(const container_header& header,
+                                            const unsigned char* encoded,
+                                            const std::size_t length,
+                                            std::vector<unsigned int>& segment_checksum)
+      {
+         const std::size_t full_rows = length / header.code_length;
+
+         segment_checksum.assign(header.segment_count() * header.code_length, 0);
+
+         for (std::size_t s = 0; (s * header.segment_rows) < full_rows; ++s)
+         {
+            const std::size_t first_row = s * header.segment_rows;
+            const std::size_t row_count = std::min<std::size_t>(header.segment_rows, full_rows - first_row);
+
+            for (std::size_t i = 0; i < header.code_length; ++i)
+            {
+               segment_checksum[(s * header.code_length) + i] = header.checksum(encoded + (i * full_rows) + first_row, row_count);
+            }
+         }
+      }
+
+      inline bool write_container_index(std::ostream& stream,
+                                        const container_header& header,
+                                        const std::vector<container_entry>& entry_list)
+      {
+         std::vector<unsigned char> buffer((entry_list.size() * header.index_entry_size) + 4);
+
+         unsigned char* entry = &buffer[0];
+
+         for (std::size_t i = 0; i < entry_list.size(); ++i, entry += header.index_entry_size)
+         {
+            details::store_le(entry     , entry_list[i].offset  , 8);
+            details::store_le(entry +  8, entry_list[i].length  , 8);
+            details::store_le(entry + 16, entry_list[i].checksum, 4);
+
+            if (header.has_data_checksum())
+            {
+               details::store_le(entry + 20, entry_list[i].data_checksum, 4);
+            }
+
+            if (header.has_segment_checksums())
+            {
+               for (std::size_t j = 0; j < entry_list[i].segment_checksum.size(); ++j)
+               {
+                  details::store_le(entry + container_header::entry_size_v2 + (4 * j), entry_list[i].segment_checksum[j], 4);
+               }
+            }
+         }
+
+         details::store_le(entry, header.checksum(&buffer[0], buffer.size() - 4), 4);
+
+         stream.write(reinterpret_cast<const char*>(&buffer[0]), static_cast<std::streamsize>(buffer.size()));
+
+         return !stream.fail();
+      }
+
+      /*
+         Read and validate the header and index of a container. Beyond
+         the checksums, the index must describe parts laid out back to
+         back from the end of the header to the start of the index.
+      */
+      inline bool read_container(std::istream& stream, container_header& header, std::vector<container_entry>& entry_list)
+      {
+         unsigned char header_buffer[container_header::size];
+
+         stream.seekg(0, std::ios::beg);
+         stream.read(reinterpret_cast<char*>(header_buffer), container_header::size);
+
+         if (stream.fail() || !header.read(header_buffer))
+            return false;
+
+         std::vector<unsigned char> buffer((header.part_count * header.index_entry_size) + 4);
+
+         stream.seekg(static_cast<std::streamoff>(header.index_offset), std::ios::beg);
+         stream.read(reinterpret_cast<char*>(&buffer[0]), static_cast<std::streamsize>(buffer.size()));
+
+         if (stream.fail())
+            return false;
+         else if (details::load_le(&buffer[buffer.size() - 4], 4) != header.checksum(&buffer[0], buffer.size() - 4))
+            return false;
+
+         entry_list.resize(header.part_count);
+
+         std::size_t expected_offset = container_header::size;
+
+         const unsigned char* entry = &buffer[0];
+
+         for (std::size_t i = 0; i < entry_list.size(); ++i, entry += header.index_entry_size)
+         {
+            entry_list[i].offset   = static_cast<std::size_t >(details::load_le(entry     , 8));
+            entry_list[i].length   = static_cast<std::size_t >(details::load_le(entry +  8, 8));
+            entry_list[i].checksum = static_cast<unsigned int>(details::load_le(entry + 16, 4));
+
+            if (header.has_data_checksum())
+            {
+               entry_list[i].data_checksum = static_cast<unsigned int>(details::load_le(entry + 20, 4));
+            }
+
+            if (header.has_segment_checksums())
+            {
+               entry_list[i].segment_checksum.resize(header.segment_count() * header.code_length);
+
+               for (std::size_t j = 0; j < entry_list[i].segment_checksum.size(); ++j)
+               {
+                  entry_list[i].segment_checksum[j] = static_cast<unsigned int>(details::load_le(entry + container_header::entry_size_v2 + (4 * j), 4));
+               }
+            }
+
+            if ((entry_list[i].offset != expected_offset) || (entry_list[i].length > header.encoded_part_size()))
+               return false;
+
+            expected_offset += entry_list[i].length;
+         }
+
+         return (expected_offset == header.index_offset);
+      }
+
+      /*
+         Decode an encoded part using its column segment checksums. Rows
+         of segments whose checksums all match are taken as they are, in
+         the other rows the columns of failing segments are decoded as
+         erasures, or when there are more of them than fec length, the
+         row is decoded for errors alone. A trailing partial row has no
+         segment checksums and is always decoded for errors.
+      */
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length>
+      inline bool decode_container_part_segments(const decoder<code_length,fec_length,data_length>& rs_decoder,
+                                                 const container_header& header,
+                                                 const container_entry&  entry,
+                                                 unsigned char*          input,
+                                                 unsigned char*          output,
+                                                 std::size_t&            failures)
+      {
+         typedef typename decoder<code_length,fec_length,data_length>::block_type block_type;
+
+         const std::size_t full_rows = entry.length / code_length;
+         const std::size_t remaining = entry.length % code_length;
+
+         std::vector<unsigned int> segment_checksum;
+
+         compute_segment_checksums(header, input, entry.length, segment_checksum);
+
+         if (segment_checksum.size() != entry.segment_checksum.size())
+            return false;
+
+         block_type block;
+         erasure_locations_t erasure_list;
+
+         for (std::size_t s = 0; (s * header.segment_rows) < full_rows; ++s)
+         {
+            erasure_list.clear();
+
+            for (std::size_t i = 0; i < code_length; ++i)
+            {
+               if (segment_checksum[(s * code_length) + i] != entry.segment_checksum[(s * code_length) + i])
+               {
+                  erasure_list.push_back(i);
+               }
+            }
+
+            if (erasure_list.empty())
+               continue;
+
+            const std::size_t first_row = s * header.segment_rows;
+            const std::size_t last_row  = std::min<std::size_t>(first_row + header.segment_rows, full_rows);
+
+            for (std::size_t j = first_row; j < last_row; ++j)
+            {
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  block[i] = input[(i * full_rows) + j];
+               }
+
+               const bool decoded = (erasure_list.size() <= fec_length) ?
+                                    rs_decoder.decode(block, erasure_list) :
+                                    rs_decoder.decode(block);
+
+               if (!decoded)
+               {
+                  ++failures;
+                  continue;
+               }
+
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  input[(i * full_rows) + j] = static_cast<unsigned char>(block[i] & 0xFF);
+               }
+            }
+         }
+
+         if (!extract_part<code_length,fec_length>(input, full_rows * code_length, output))
+            return false;
+
+         if (remaining > 0)
+         {
+            return decode_part(rs_decoder,
+                               input  + (full_rows * code_length),
+                               remaining,
+                               output + (full_rows * data_length),
+                               failures);
+         }
+
+         return true;
+      }
+
+      /*
+         Restore the original data of a container part from its encoded
+         form in input, which is modified. A part whose checksum matches
+         is intact and only has its data copied out, the remaining parts
+         are decoded, making use of the column segment checksums where
+         the container has them. When the container records data checksums, the
+         check is made on the copied out data, and a decoded part that
+         still does not match is counted as a failure even if every
+         codeword appeared correctable. intact reports whether decoding
+         was skipped. Returns false only when the entry cannot be that
+         of an encoded part.
+      */
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length>
+      inline bool restore_container_part(const decoder<code_length,fec_length,data_length>& rs_decoder,
+                                         const container_header& header,
+                                         const container_entry&  entry,
+                                         unsigned char*          input,
+                                         unsigned char*          output,
+                                         std::size_t&            failures,
+                                         bool&                   intact)
+      {
+         const std::size_t output_length = decoded_part_size<code_length,fec_length>(entry.length);
+
+         if (header.has_data_checksum())
+         {
+            if (!extract_part<code_length,fec_length>(input, entry.length, output))
+               return false;
+
+            intact = (entry.data_checksum == header.checksum(output, output_length));
+         }
+         else
+         {
+            intact = (entry.checksum == header.checksum(input, entry.length));
+
+            if (intact && !extract_part<code_length,fec_length>(input, entry.length, output))
+               return false;
+         }
+
+         if (intact)
+            return true;
+
+         std::size_t part_failures = 0;
+
+         if (header.has_segment_checksums())
+         {
+            if (!decode_container_part_segments(rs_decoder, header, entry, input, output, part_failures))
+               return false;
+         }
+         else if (!decode_part(rs_decoder, input, entry.length, output, part_failures))
+            return false;
+
+         if (
+              header.has_data_checksum() && (0 == part_failures) &&
+              (entry.data_checksum != header.checksum(output, output_length))
+            )
+         {
+            part_failures = 1;
+         }
+
+         failures += part_failures;
+
+         return true;
+      }
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
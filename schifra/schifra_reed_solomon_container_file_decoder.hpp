@@ -0,0 +1,276 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_CONTAINER_FILE_DECODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_CONTAINER_FILE_DECODER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_container.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_reed_solomon_file_pipeline.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Part processor restoring container parts, see
+         restore_container_part, and flagging those found damaged.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      class container_part_decoder
+      {
+      public:
+
+         typedef decoder<code_length,fec_length> decoder_type;
+
+         container_part_decoder(const decoder_type& rs_decoder,
+                                const container_header& header,
+                                const std::vector<container_entry>& entry_list,
+                                std::vector<unsigned char>& damaged_list)
+         : decoder_(rs_decoder),
+           header_(header),
+           entry_list_(entry_list),
+           damaged_list_(damaged_list)
+         {}
+
+         inline bool process_part(file_part& part) const
+         {
+            const container_entry& entry = entry_list_[part.index];
+
+            if (part.length != entry.length)
+               return false;
+
+            bool intact = false;
+
+            if (!restore_container_part(decoder_,
+                                        header_,
+                                        entry,
+                                        reinterpret_cast<unsigned char*>(&part.input[0]),
+                                        &part.output[0],
+                                        part.failures,
+                                        intact))
+            {
+               return false;
+            }
+
+            damaged_list_[part.index] = intact ? 0 : 1;
+            part.output_length        = decoded_part_size<code_length,fec_length>(part.length);
+
+            return true;
+         }
+
+      private:
+
+         const decoder_type& decoder_;
+         const container_header& header_;
+         const std::vector<container_entry>& entry_list_;
+         std::vector<unsigned char>& damaged_list_;
+      };
+
+      /*
+         Restores a file from a container written by container_file_encoder.
+         The part size and original file size are taken from the container
+         itself, and the parts are decoded concurrently as by
+         parallel_file_decoder. Only the parts that fail their checksum
+         are put through the decoder, these are counted as damaged.
+      */
+      template <std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class container_file_decoder
+      {
+      public:
+
+         typedef decoder<code_length,fec_length> decoder_type;
+
+         container_file_decoder(const decoder_type& decoder,
+                                const std::string& input_file_name,
+                                const std::string& output_file_name,
+                                const std::size_t thread_count = 0)
+         : success_(false),
+           failure_count_(0),
+           damaged_part_count_(0)
+         {
+            std::ifstream in_stream(input_file_name.c_str(),std::ios::binary);
+
+            if (!in_stream)
+            {
+               std::cout << "reed_solomon::container_file_decoder() - Error: input file could not be opened." << std::endl;
+               return;
+            }
+
+            container_header header;
+            std::vector<container_entry> entry_list;
+
+            if (!read_container(in_stream,header,entry_list))
+            {
+               std::cout << "reed_solomon::container_file_decoder() - Error: input file is not a valid container." << std::endl;
+               return;
+            }
+            else if ((code_length != header.code_length) || (fec_length != header.fec_length))
+            {
+               std::cout << "reed_solomon::container_file_decoder() - Error: container was encoded with RS("
+                         << header.code_length << "," << (header.code_length - header.fec_length) << ")." << std::endl;
+               return;
+            }
+
+            std::ofstream out_stream(output_file_name.c_str(),std::ios::binary);
+
+            if (!out_stream)
+            {
+               std::cout << "reed_solomon::container_file_decoder() - Error: output file could not be created." << std::endl;
+               return;
+            }
+
+            std::vector<unsigned char> damaged_list(entry_list.size(),0);
+
+            typedef container_part_decoder<code_length,fec_length> processor_type;
+
+            const processor_type processor(decoder, header, entry_list, damaged_list);
+
+            file_pipeline<processor_type> pipeline(processor,
+                                                   "reed_solomon::container_file_decoder()",
+                                                   header.encoded_part_size(),
+                                                   header.part_rows * data_length,
+                                                   thread_count);
+
+            in_stream.clear();
+            in_stream.seekg(container_header::size, std::ios::beg);
+
+            success_            = pipeline.run(in_stream, out_stream, header.index_offset - container_header::size);
+            failure_count_      = pipeline.failure_count();
+            damaged_part_count_ = static_cast<std::size_t>(std::count(damaged_list.begin(), damaged_list.end(), 1));
+
+            if (failure_count_ > 0)
+            {
+               std::cout << "reed_solomon::container_file_decoder() - Error: "
+                         << failure_count_ << " codeword(s) could not be corrected." << std::endl;
+            }
+
+            in_stream.close();
+            out_stream.close();
+         }
+
+         /* True when the whole file was read, decoded and fully corrected. */
+         inline bool success() const
+         {
+            return success_ && (0 == failure_count_);
+         }
+
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+         inline std::size_t damaged_part_count() const
+         {
+            return damaged_part_count_;
+         }
+
+      private:
+
+         container_file_decoder(const container_file_decoder&);
+         container_file_decoder& operator=(const container_file_decoder&);
+
+         bool success_;
+         std::size_t failure_count_;
+         std::size_t damaged_part_count_;
+      };
+
+      /*
+         Restore range_length bytes of the original file, starting at
+         range_offset, from a container. Only the parts overlapping the
+         range are located through the index, read and restored as by
+         restore_container_part. Codewords that cannot be corrected are
+         output as received and added to failures.
+      */
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length>
+      inline bool decode_container_range(const decoder<code_length,fec_length,data_length>& rs_decoder,
+                                         const std::string& input_file_name,
+                                         const std::size_t  range_offset,
+                                         const std::size_t  range_length,
+                                         std::ostream&      out_stream,
+                                         std::size_t&       failures)
+      {
+         std::ifstream in_stream(input_file_name.c_str(),std::ios::binary);
+
+         container_header header;
+         std::vector<container_entry> entry_list;
+
+         if (!in_stream || !read_container(in_stream,header,entry_list))
+            return false;
+         else if ((code_length != header.code_length) || (fec_length != header.fec_length))
+            return false;
+         else if ((range_offset > header.file_size) || (range_length > (header.file_size - range_offset)))
+            return false;
+         else if (0 == range_length)
+            return true;
+
+         const std::size_t part_size  = header.input_part_size();
+         const std::size_t first_part = range_offset / part_size;
+         const std::size_t last_part  = (range_offset + range_length - 1) / part_size;
+
+         std::vector<unsigned char> input (header.encoded_part_size());
+         std::vector<unsigned char> output(part_size);
+
+         for (std::size_t i = first_part; i <= last_part; ++i)
+         {
+            const container_entry& entry = entry_list[i];
+
+            in_stream.seekg(static_cast<std::streamoff>(entry.offset), std::ios::beg);
+            in_stream.read(reinterpret_cast<char*>(&input[0]), static_cast<std::streamsize>(entry.length));
+
+            bool intact = false;
+
+            if (in_stream.fail() || !restore_container_part(rs_decoder, header, entry, &input[0], &output[0], failures, intact))
+               return false;
+
+            const std::size_t part_begin = i * part_size;
+            const std::size_t begin      = std::max(range_offset, part_begin) - part_begin;
+            const std::size_t end        = std::min(range_offset + range_length, part_begin + decoded_part_size<code_length,fec_length>(entry.length)) - part_begin;
+
+            out_stream.write(reinterpret_cast<const char*>(&output[begin]), static_cast<std::streamsize>(end - begin));
+
+            if (out_stream.fail())
+               return false;
+         }
+
+         return true;
+      }
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
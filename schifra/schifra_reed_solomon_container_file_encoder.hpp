@@ -0,0 +1,224 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_CONTAINER_FILE_ENCODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_CONTAINER_FILE_ENCODER_HPP
+
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_container.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_reed_solomon_file_pipeline.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Part encoder that additionally records the length and checksums
+         of every part in the container index. Each part only
+         ever touches its own entry, so the workers need no locking.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      class container_part_encoder
+      {
+      public:
+
+         typedef encoder<code_length,fec_length> encoder_type;
+
+         container_part_encoder(const encoder_type& rs_encoder,
+                                const container_header& header,
+                                std::vector<container_entry>& entry_list)
+         : part_encoder_(rs_encoder),
+           header_(header),
+           entry_list_(entry_list)
+         {}
+
+         inline bool process_part(file_part& part) const
+         {
+            if (!part_encoder_.process_part(part))
+               return false;
+
+            container_entry& entry = entry_list_[part.index];
+
+            entry.length        = part.output_length;
+            entry.checksum      = header_.checksum(&part.output[0], part.output_length);
+            entry.data_checksum = header_.checksum(reinterpret_cast<const unsigned char*>(&part.input[0]), part.length);
+
+            if (header_.has_segment_checksums())
+            {
+               compute_segment_checksums(header_, &part.output[0], part.output_length, entry.segment_checksum);
+            }
+
+            return true;
+         }
+
+      private:
+
+         const file_part_encoder<code_length,fec_length> part_encoder_;
+         const container_header& header_;
+         std::vector<container_entry>& entry_list_;
+      };
+
+      /*
+         Encodes a file into a container, see container_header, with the
+         parts encoded concurrently as by parallel_file_encoder. The
+         container carries everything needed to decode it other than the
+         field and generator polynomial. Unless segment_rows is zero, the
+         columns of every part are checksummed in segments of that many
+         rows, allowing damaged segments to be decoded as erasures at the
+         cost of four index bytes per segment.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class container_file_encoder
+      {
+      public:
+
+         typedef encoder<code_length,fec_length> encoder_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * data_length       };
+         enum { part_output_size = part_rows * code_length       };
+
+         enum { default_segment_rows = 512 };
+
+         container_file_encoder(const encoder_type& encoder,
+                                const std::string& input_file_name,
+                                const std::string& output_file_name,
+                                const std::size_t thread_count = 0,
+                                const std::size_t segment_rows = default_segment_rows)
+         : success_(false)
+         {
+            const std::size_t file_size = schifra::fileio::file_size(input_file_name);
+
+            if (0 == file_size)
+            {
+               std::cout << "reed_solomon::container_file_encoder() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            std::ifstream in_stream(input_file_name.c_str(),std::ios::binary);
+
+            if (!in_stream)
+            {
+               std::cout << "reed_solomon::container_file_encoder() - Error: input file could not be opened." << std::endl;
+               return;
+            }
+
+            std::ofstream out_stream(output_file_name.c_str(),std::ios::binary);
+
+            if (!out_stream)
+            {
+               std::cout << "reed_solomon::container_file_encoder() - Error: output file could not be created." << std::endl;
+               return;
+            }
+
+            container_header header;
+
+            header.code_length  = code_length;
+            header.fec_length   = fec_length;
+            header.part_rows    = part_rows;
+            header.segment_rows = static_cast<unsigned int>(segment_rows);
+            header.file_size    = file_size;
+            header.part_count   = (file_size + part_input_size - 1) / part_input_size;
+            header.index_offset = container_header::size +
+                                  ((file_size / part_input_size) * part_output_size) +
+                                  encoded_part_size<code_length,fec_length>(file_size % part_input_size);
+
+            unsigned char header_buffer[container_header::size];
+
+            if (segment_rows > 0)
+            {
+               header.version          = container_header::version_3;
+               header.index_entry_size = static_cast<unsigned int>(header.expected_entry_size());
+            }
+
+            header.write(header_buffer);
+
+            out_stream.write(reinterpret_cast<const char*>(header_buffer), container_header::size);
+
+            std::vector<container_entry> entry_list(header.part_count);
+
+            typedef container_part_encoder<code_length,fec_length> processor_type;
+
+            const processor_type processor(encoder, header, entry_list);
+
+            file_pipeline<processor_type> pipeline(processor,
+                                                   "reed_solomon::container_file_encoder()",
+                                                   part_input_size,
+                                                   part_output_size,
+                                                   thread_count);
+
+            if (!pipeline.run(in_stream,out_stream,file_size))
+               return;
+
+            std::size_t offset = container_header::size;
+
+            for (std::size_t i = 0; i < entry_list.size(); ++i)
+            {
+               entry_list[i].offset = offset;
+               offset += entry_list[i].length;
+            }
+
+            if (!write_container_index(out_stream,header,entry_list))
+            {
+               std::cout << "reed_solomon::container_file_encoder() - Error: index could not be written." << std::endl;
+               return;
+            }
+
+            in_stream.close();
+            out_stream.close();
+
+            success_ = true;
+         }
+
+         inline bool success() const
+         {
+            return success_;
+         }
+
+      private:
+
+         container_file_encoder(const container_file_encoder&);
+         container_file_encoder& operator=(const container_file_encoder&);
+
+         bool success_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
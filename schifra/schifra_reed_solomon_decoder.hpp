@@ -24,10 +24,17 @@
 #define INCLUDE_SCHIFRA_REED_SOLOMON_DECODER_HPP
 
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
 #include "schifra_galois_field.hpp"
 #include "schifra_galois_field_element.hpp"
 #include "schifra_galois_field_polynomial.hpp"
+#include "schifra_galois_region_multiplier.hpp"
 #include "schifra_reed_solomon_block.hpp"
+#include "schifra_reed_solomon_decoder_profile.hpp"
 #include "schifra_ecc_traits.hpp"
 
 
@@ -36,6 +43,31 @@ namespace schifra
    namespace reed_solomon
    {
 
+      /*
+         Scratch space for a single decode, sized at compile time from the
+         fec length, so that decoding never touches the heap. A workspace
+         may be reused for any number of decodes, though not concurrently
+         by more than one thread.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      struct decoder_workspace
+      {
+         enum { polynomial_capacity = 2 * fec_length + 2 };
+
+         galois::field_symbol syndrome       [fec_length];
+         galois::field_symbol lambda         [polynomial_capacity];
+         galois::field_symbol previous_lambda[polynomial_capacity];
+         galois::field_symbol tau            [polynomial_capacity];
+         galois::field_symbol omega          [fec_length];
+         galois::field_symbol remainder      [fec_length + 1];
+         galois::field_symbol previous_remainder[fec_length + 1];
+         int                  error_location [polynomial_capacity];
+         int                  chien_register [polynomial_capacity];
+         int                  chien_step     [polynomial_capacity];
+         int                  lambda_degree;
+         std::size_t          error_count;
+      };
+
       template <std::size_t code_length, std::size_t fec_length, std::size_t data_length = code_length - fec_length>
       class decoder
       {
@@ -43,12 +75,30 @@ namespace schifra
 
          typedef traits::reed_solomon_triat<code_length,fec_length,data_length> trait;
          typedef block<code_length,fec_length> block_type;
+         typedef decoder_workspace<code_length,fec_length> workspace_type;
+
+         /*
+            Solver of the key equation, giving the error locator lambda
+            and the error evaluator omega from the syndrome. The modified
+            Berlekamp-Massey algorithm obtains lambda alone, omega then
+            being the product (lambda * syndrome) mod x^fec_length. The
+            extended Euclidean (Sugiyama) algorithm obtains both at once.
+         */
+         enum key_equation_solver_t
+         {
+            e_berlekamp_massey = 0,
+            e_euclidean        = 1
+         };
 
-         decoder(const galois::field& field, const unsigned int& gen_initial_index = 0)
+         decoder(const galois::field& field,
+                 const unsigned int& gen_initial_index = 0,
+                 const key_equation_solver_t key_equation_solver = e_berlekamp_massey)
          : decoder_valid_(field.size() == code_length),
            field_(field),
            X_(galois::generate_X(field_)),
-           gen_initial_index_(gen_initial_index)
+           gen_initial_index_(gen_initial_index),
+           key_equation_solver_(key_equation_solver),
+           region_(field)
          {
             if (decoder_valid_)
             {
@@ -62,13 +112,324 @@ namespace schifra
             return field_;
          }
 
+         inline key_equation_solver_t key_equation_solver() const
+         {
+            return key_equation_solver_;
+         }
+
          bool decode(block_type& rsblock) const
          {
-            std::vector<std::size_t> erasure_list;
-            return decode(rsblock,erasure_list);
+            workspace_type workspace;
+            return decode(rsblock,workspace);
          }
 
          bool decode(block_type& rsblock, const erasure_locations_t& erasure_list) const
+         {
+            workspace_type workspace;
+            return decode(rsblock,erasure_list,workspace);
+         }
+
+         bool decode(block_type& rsblock, workspace_type& workspace) const
+         {
+            const erasure_locations_t erasure_list;
+            return decode(rsblock,erasure_list,workspace);
+         }
+
+         bool decode(block_type& rsblock, const erasure_locations_t& erasure_list, workspace_type& workspace) const
+         {
+            return decode_block(rsblock,erasure_list,workspace);
+         }
+
+         /*
+            Decode a codeword of this code shortened to shortened_length
+            symbols, that is with code_length - shortened_length leading
+            symbols implied to be zero. Erasure positions are relative to
+            the shortened codeword. Only the real symbol positions are
+            visited by the syndrome and Chien search, and an error located
+            among the implied zeros renders the codeword uncorrectable.
+         */
+         template <std::size_t shortened_length>
+         bool decode_shortened(block<shortened_length,fec_length>& rsblock) const
+         {
+            workspace_type workspace;
+            const erasure_locations_t erasure_list;
+            return decode_block(rsblock,erasure_list,workspace);
+         }
+
+         template <std::size_t shortened_length>
+         bool decode_shortened(block<shortened_length,fec_length>& rsblock,
+                               const erasure_locations_t& erasure_list,
+                               workspace_type& workspace) const
+         {
+            return decode_block(rsblock,erasure_list,workspace);
+         }
+
+         inline bool supports_interleaved() const
+         {
+            return decoder_valid_ && region_.valid();
+         }
+
+         /*
+            Compute the syndromes of row_count codewords held column-wise,
+            such that column[i][r] is symbol i of codeword r, into
+            syndrome[k][r]. Every syndrome is evaluated by Horner's rule
+            over the codeword symbols, each step being a region scale-add
+            across all of the codewords at once. Returns true if any of
+            the syndromes are non-zero. Requires byte sized symbols, see
+            supports_interleaved().
+         */
+         inline bool compute_syndromes_interleaved(const unsigned char* const column[],
+                                                   const std::size_t          row_count,
+                                                   unsigned char* const       syndrome[]) const
+         {
+            unsigned char error_flag = 0;
+
+            for (std::size_t offset = 0; offset < row_count; offset += interleaved_tile_rows)
+            {
+               const std::size_t rows = std::min(interleaved_tile_rows, row_count - offset);
+
+               for (std::size_t k = 0; k < fec_length; ++k)
+               {
+                  std::memcpy(syndrome[k] + offset, column[0] + offset, rows);
+               }
+
+               for (std::size_t i = 1; i < code_length; ++i)
+               {
+                  for (std::size_t k = 0; k < fec_length; ++k)
+                  {
+                     region_.scale_add(syndrome_exponent_table_[k], column[i] + offset, syndrome[k] + offset, rows);
+                  }
+               }
+
+               for (std::size_t k = 0; k < fec_length; ++k)
+               {
+                  const unsigned char* s = syndrome[k] + offset;
+
+                  for (std::size_t r = 0; r < rows; ++r)
+                  {
+                     error_flag |= s[r];
+                  }
+               }
+            }
+
+            return (0 != error_flag);
+         }
+
+         /*
+            Decode row_count codewords held column-wise, as described
+            above. Syndromes are computed for a tile of codewords at a
+            time, a tile whose syndromes are all zero is passed over as
+            is, otherwise only those codewords with non-zero syndromes
+            are gathered and decoded individually. Returns true if every
+            codeword was either clean or successfully corrected.
+         */
+         inline bool decode_interleaved(unsigned char* const column[], const std::size_t row_count) const
+         {
+            std::size_t failures = 0;
+            return decode_interleaved(column,row_count,failures);
+         }
+
+         /*
+            As above, additionally reporting the number of codewords that
+            could not be corrected, those are left as received.
+         */
+         inline bool decode_interleaved(unsigned char* const column[],
+                                        const std::size_t    row_count,
+                                        std::size_t&         failures) const
+         {
+            failures = 0;
+
+            if (!supports_interleaved())
+            {
+               return false;
+            }
+
+            unsigned char        syndrome_tile[fec_length][interleaved_tile_rows];
+            unsigned char*       syndrome[fec_length];
+            const unsigned char* tile_column[code_length];
+
+            const erasure_locations_t no_erasures;
+            workspace_type            workspace;
+            block_type                rsblock;
+
+            for (std::size_t k = 0; k < fec_length; ++k)
+            {
+               syndrome[k] = syndrome_tile[k];
+            }
+
+            for (std::size_t offset = 0; offset < row_count; offset += interleaved_tile_rows)
+            {
+               const std::size_t rows = std::min(interleaved_tile_rows, row_count - offset);
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  tile_column[i] = column[i] + offset;
+               }
+
+               bool tile_dirty = false;
+
+               {
+                  decoder_stage_timer timer(decoder_profile::e_syndrome);
+                  tile_dirty = compute_syndromes_interleaved(tile_column, rows, syndrome);
+               }
+
+               if (!tile_dirty)
+               {
+                  record_clean_blocks(rows);
+                  continue;
+               }
+
+               for (std::size_t r = 0; r < rows; ++r)
+               {
+                  unsigned char row_flag = 0;
+
+                  for (std::size_t k = 0; k < fec_length; ++k)
+                  {
+                     row_flag |= syndrome_tile[k][r];
+                     workspace.syndrome[k] = syndrome_tile[k][r];
+                  }
+
+                  if (0 == row_flag)
+                  {
+                     record_clean_blocks(1);
+                     continue;
+                  }
+
+                  for (std::size_t i = 0; i < code_length; ++i)
+                  {
+                     rsblock[i] = column[i][offset + r];
+                  }
+
+                  const bool corrected = correct(rsblock,no_erasures,workspace);
+
+                  record_decoded_block(rsblock.errors_detected,corrected);
+
+                  if (corrected)
+                  {
+                     for (std::size_t i = 0; i < code_length; ++i)
+                     {
+                        column[i][offset + r] = static_cast<unsigned char>(rsblock[i] & 0xFF);
+                     }
+                  }
+                  else
+                     ++failures;
+               }
+            }
+
+            return (0 == failures);
+         }
+
+         /*
+            Determine the health of a codeword without correcting it, by
+            computing its syndrome and, only if that is non-zero, locating
+            its errors. error_count is set to the number of symbols in
+            error. Returns false if the codeword could not be corrected.
+         */
+         inline bool check(const block_type& rsblock, std::size_t& error_count, workspace_type& workspace) const
+         {
+            error_count = 0;
+
+            if (!decoder_valid_)
+               return false;
+
+            if (compute_syndrome(rsblock,workspace.syndrome) == 0)
+               return true;
+
+            const erasure_locations_t no_erasures;
+
+            locate_errors(no_erasures,workspace);
+
+            if (!errors_locatable(workspace))
+               return false;
+
+            error_count = workspace.error_count;
+
+            return true;
+         }
+
+         /*
+            Read-only counterpart of decode_interleaved, for scrubbing.
+            Codewords with non-zero syndromes are counted as dirty and
+            have their errors located but not corrected. error_count is
+            the total of symbols in error over the correctable codewords,
+            failures the number of uncorrectable codewords.
+         */
+         inline bool check_interleaved(const unsigned char* const column[],
+                                       const std::size_t          row_count,
+                                       std::size_t&               dirty_rows,
+                                       std::size_t&               error_count,
+                                       std::size_t&               failures) const
+         {
+            dirty_rows  = 0;
+            error_count = 0;
+            failures    = 0;
+
+            if (!supports_interleaved())
+            {
+               return false;
+            }
+
+            unsigned char        syndrome_tile[fec_length][interleaved_tile_rows];
+            unsigned char*       syndrome[fec_length];
+            const unsigned char* tile_column[code_length];
+
+            const erasure_locations_t no_erasures;
+            workspace_type            workspace;
+
+            for (std::size_t k = 0; k < fec_length; ++k)
+            {
+               syndrome[k] = syndrome_tile[k];
+            }
+
+            for (std::size_t offset = 0; offset < row_count; offset += interleaved_tile_rows)
+            {
+               const std::size_t rows = std::min(interleaved_tile_rows, row_count - offset);
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  tile_column[i] = column[i] + offset;
+               }
+
+               if (!compute_syndromes_interleaved(tile_column, rows, syndrome))
+                  continue;
+
+               for (std::size_t r = 0; r < rows; ++r)
+               {
+                  unsigned char row_flag = 0;
+
+                  for (std::size_t k = 0; k < fec_length; ++k)
+                  {
+                     row_flag |= syndrome_tile[k][r];
+                     workspace.syndrome[k] = syndrome_tile[k][r];
+                  }
+
+                  if (0 == row_flag)
+                     continue;
+
+                  ++dirty_rows;
+
+                  locate_errors(no_erasures,workspace);
+
+                  if (errors_locatable(workspace))
+                     error_count += workspace.error_count;
+                  else
+                     ++failures;
+               }
+            }
+
+            return (0 == failures);
+         }
+
+      private:
+
+         decoder();
+         decoder(const decoder& dec);
+         decoder& operator=(const decoder& dec);
+
+      protected:
+
+         template <typename Block>
+         bool decode_block(Block& rsblock, const erasure_locations_t& erasure_list, workspace_type& workspace) const
          {
             if ((!decoder_valid_) || (erasure_list.size() > fec_length))
             {
@@ -76,47 +437,108 @@ namespace schifra
                rsblock.errors_corrected = 0;
                rsblock.zero_numerators  = 0;
                rsblock.unrecoverable    = true;
-               rsblock.error            = block_type::e_decoder_error0;
+               rsblock.error            = Block::e_decoder_error0;
 
                return false;
             }
 
-            galois::field_polynomial received(field_,code_length - 1);
-            load_message(received,rsblock);
+            int syndrome_flag = 0;
 
-            galois::field_polynomial syndrome(field_);
+            {
+               decoder_stage_timer timer(decoder_profile::e_syndrome);
+               syndrome_flag = compute_syndrome(rsblock,workspace.syndrome);
+            }
 
-            if (compute_syndrome(received,syndrome) == 0)
+            if (0 == syndrome_flag)
             {
                rsblock.errors_detected  = 0;
                rsblock.errors_corrected = 0;
                rsblock.zero_numerators  = 0;
                rsblock.unrecoverable    = false;
 
+               record_clean_blocks(1);
+
                return true;
             }
 
-            galois::field_polynomial lambda(galois::field_element(field_,1));
+            const bool result = correct(rsblock,erasure_list,workspace);
 
-            erasure_locations_t erasure_locations;
+            record_decoded_block(rsblock.errors_detected,result);
+
+            return result;
+         }
+
+         /*
+            The number of leading zero symbols implied by a block of a
+            code shortened from this one, zero for a full length block.
+         */
+         template <typename Block>
+         static inline std::size_t implied_padding()
+         {
+            return code_length - static_cast<std::size_t>(Block::trait::code_length);
+         }
+
+         void locate_errors(const erasure_locations_t& erasure_list,
+                            workspace_type& workspace,
+                            const std::size_t padding_length = 0) const
+         {
+            /*
+               Obtain the error locator and its roots given a non-zero
+               syndrome, which is expected to already be present in the
+               workspace. With the euclidean solver the error evaluator
+               is obtained as well.
+            */
+            std::fill_n(workspace.lambda, static_cast<std::size_t>(workspace_type::polynomial_capacity), galois::field_symbol(0));
+
+            workspace.lambda[0]     = 1;
+            workspace.lambda_degree = 0;
 
-            if (!erasure_list.empty())
             {
-               prepare_erasure_list(erasure_locations, erasure_list);
+               decoder_stage_timer timer(decoder_profile::e_key_equation);
+
+               if (!erasure_list.empty())
+               {
+                  compute_gamma(workspace, erasure_list, padding_length);
+               }
 
-               compute_gamma(lambda, erasure_locations);
+               if (e_euclidean == key_equation_solver_)
+               {
+                  euclidean_algorithm(workspace, erasure_list.size());
+               }
+               else if (erasure_list.size() < fec_length)
+               {
+                  modified_berlekamp_massey_algorithm(workspace, erasure_list.size());
+               }
             }
 
-            if (erasure_list.size() < fec_length)
             {
-               modified_berlekamp_massey_algorithm(lambda, syndrome, erasure_list.size());
+               decoder_stage_timer timer(decoder_profile::e_chien_search);
+               find_roots(workspace, padding_length);
             }
+         }
 
-            std::vector<int> error_locations;
+         inline bool errors_locatable(const workspace_type& workspace) const
+         {
+            /*
+               A located error pattern is correctable when the locator has
+               as many distinct roots as its degree, and 2E <= fec_length.
+               Forney then always finds a non-zero derivative at the roots.
+            */
+            return (workspace.error_count > 0)                                       &&
+                   (static_cast<int>(workspace.error_count) == workspace.lambda_degree) &&
+                   ((2 * workspace.error_count) <= fec_length);
+         }
 
-            find_roots(lambda, error_locations);
+         template <typename Block>
+         bool correct(Block& rsblock, const erasure_locations_t& erasure_list, workspace_type& workspace) const
+         {
+            /*
+               Correct the block given its non-zero syndrome, which is
+               expected to already be present in the workspace.
+            */
+            locate_errors(erasure_list, workspace, implied_padding<Block>());
 
-            if (0 == error_locations.size())
+            if (0 == workspace.error_count)
             {
                /*
                  Syndrome is non-zero yet no error locations have
@@ -130,11 +552,11 @@ namespace schifra
                rsblock.errors_corrected = 0;
                rsblock.zero_numerators  = 0;
                rsblock.unrecoverable    = true;
-               rsblock.error            = block_type::e_decoder_error1;
+               rsblock.error            = Block::e_decoder_error1;
 
                return false;
             }
-            else if (((2 * error_locations.size()) - erasure_list.size()) > fec_length)
+            else if (((2 * workspace.error_count) - erasure_list.size()) > fec_length)
             {
                /*
                   Too many errors\erasures! 2E + S <= fec_length
@@ -150,38 +572,25 @@ namespace schifra
 
                */
 
-               rsblock.errors_detected  = error_locations.size();
+               rsblock.errors_detected  = workspace.error_count;
                rsblock.errors_corrected = 0;
                rsblock.zero_numerators  = 0;
                rsblock.unrecoverable    = true;
-               rsblock.error            = block_type::e_decoder_error2;
+               rsblock.error            = Block::e_decoder_error2;
 
                return false;
             }
             else
-               rsblock.errors_detected  = error_locations.size();
-
-            return forney_algorithm(error_locations, lambda, syndrome, rsblock);
-         }
-
-      private:
-
-         decoder();
-         decoder(const decoder& dec);
-         decoder& operator=(const decoder& dec);
-
-      protected:
+               rsblock.errors_detected  = workspace.error_count;
 
-         void load_message(galois::field_polynomial& received, const block_type& rsblock) const
-         {
-            /*
-              Load message data into received polynomial in reverse order.
-            */
+            decoder_stage_timer timer(decoder_profile::e_forney);
 
-            for (std::size_t i = 0; i < code_length; ++i)
+            if (e_berlekamp_massey == key_equation_solver_)
             {
-               received[code_length - 1 - i] = rsblock[i];
+               compute_omega(workspace);
             }
+
+            return forney_algorithm(workspace, rsblock);
          }
 
          void create_lookup_tables()
@@ -200,11 +609,51 @@ namespace schifra
                syndrome_exponent_table_.push_back(field_.alpha(gen_initial_index_ + i));
             }
 
-            gamma_table_.reserve(field_.size() + 1);
+            /*
+               Quadratic root table: for each c, some y such that y^2 + y = c,
+               or -1 when no such y exists. The second root is then y + 1.
+            */
+            quadratic_root_table_.resize(field_.size() + 1, -1);
 
-            for (int i = 0; i < static_cast<int>(field_.size() + 1); ++i)
+            for (galois::field_symbol y = 0; y <= static_cast<galois::field_symbol>(field_.size()); ++y)
+            {
+               quadratic_root_table_[field_.mul(y,y) ^ y] = y;
+            }
+
+            /*
+               For byte sized symbols, row j of the Chien table holds alpha^(j.i)
+               for each candidate position i in [1,code_length], so that an
+               error locator of degree up to fec_length can be evaluated at all
+               positions at once with one region multiply-accumulate per term.
+            */
+            if (region_.valid())
             {
-               gamma_table_.push_back((1 + (X_ * galois::field_element(field_,field_.alpha(i)))));
+               /*
+                  Row i of the syndrome table holds the powers of each of the
+                  generator roots for the term at block position i, hence a
+                  block's syndromes are the sum of its symbols' scaled rows.
+               */
+               syndrome_table_.resize(code_length * fec_length);
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  for (std::size_t k = 0; k < fec_length; ++k)
+                  {
+                     syndrome_table_[i * fec_length + k] = static_cast<unsigned char>(field_.exp(syndrome_exponent_table_[k], static_cast<int>(code_length - 1 - i)));
+                  }
+               }
+
+               chien_table_.resize((fec_length + 1) * code_length);
+
+               for (std::size_t j = 0; j <= fec_length; ++j)
+               {
+                  unsigned char* row = &chien_table_[j * code_length];
+
+                  for (std::size_t i = 1; i <= code_length; ++i)
+                  {
+                     row[i - 1] = static_cast<unsigned char>(field_.alpha(static_cast<galois::field_symbol>((j * i) % code_length)));
+                  }
+               }
             }
          }
 
@@ -224,16 +673,74 @@ namespace schifra
             }
          }
 
-         int compute_syndrome(const galois::field_polynomial& received,
-                                    galois::field_polynomial& syndrome) const
+         template <typename Block>
+         int compute_syndrome(const Block& rsblock, galois::field_symbol syndrome[]) const
          {
+            /*
+               Evaluate the received polynomial at each of the roots of the
+               generator, directly over the block symbols. Byte sized symbols
+               use the syndrome table, otherwise Horner's rule is applied to
+               all of the syndromes at once from the highest order term down,
+               keeping the fec_length evaluations independent of each other.
+               The implied leading zeros of a shortened block contribute
+               nothing to either, hence only its own symbols are visited.
+            */
+            const std::size_t block_length = Block::trait::code_length;
+            const std::size_t padding      = implied_padding<Block>();
+
             int error_flag = 0;
+
+            if (!syndrome_table_.empty())
+            {
+               unsigned char value[fec_length];
+
+               std::memset(value, 0x00, fec_length);
+
+               for (std::size_t j = 0; j < block_length; ++j)
+               {
+                  region_.mul_add(rsblock[j], &syndrome_table_[(padding + j) * fec_length], value, fec_length);
+               }
+
+               for (std::size_t i = 0; i < fec_length; ++i)
+               {
+                  syndrome[i]  = value[i];
+                  error_flag  |= value[i];
+               }
+
+               return error_flag;
+            }
+
+            std::fill_n(syndrome, fec_length, galois::field_symbol(0));
+
+            for (std::size_t j = 0; j < block_length; ++j)
+            {
+               const galois::field_symbol symbol = rsblock[j];
+
+               for (std::size_t i = 0; i < fec_length; ++i)
+               {
+                  syndrome[i] = field_.mul(syndrome[i], syndrome_exponent_table_[i]) ^ symbol;
+               }
+            }
+
+            for (std::size_t i = 0; i < fec_length; ++i)
+            {
+               error_flag |= syndrome[i];
+            }
+
+            return error_flag;
+         }
+
+         int compute_syndrome(const block_type& rsblock, galois::field_polynomial& syndrome) const
+         {
+            galois::field_symbol syndrome_symbol[fec_length];
+
+            const int error_flag = compute_syndrome(rsblock, syndrome_symbol);
+
             syndrome = galois::field_polynomial(field_,fec_length - 1);
 
             for (std::size_t i = 0; i < fec_length; ++i)
             {
-               syndrome[i]  = received(syndrome_exponent_table_[i]);
-               error_flag  |= syndrome[i].poly();
+               syndrome[i] = syndrome_symbol[i];
             }
 
             return error_flag;
@@ -243,128 +750,543 @@ namespace schifra
          {
             for (std::size_t i = 0; i < erasure_locations.size(); ++i)
             {
-               gamma *= gamma_table_[erasure_locations[i]];
+               gamma *= (1 + (X_ * galois::field_element(field_,field_.alpha(erasure_locations[i]))));
             }
          }
 
-         void find_roots(const galois::field_polynomial& poly, std::vector<int>& root_list) const
+         void compute_gamma(workspace_type& workspace,
+                            const erasure_locations_t& erasure_list,
+                            const std::size_t padding_length) const
+         {
+            /*
+               Erasure locator: the product of (1 + X.alpha^l) over each of
+               the erasure locations l, accumulated in place in lambda.
+               Erasure positions of a shortened block are offset by its
+               padding length.
+            */
+            galois::field_symbol* lambda = workspace.lambda;
+
+            for (std::size_t i = 0; i < erasure_list.size(); ++i)
+            {
+               const galois::field_symbol root = field_.alpha(static_cast<galois::field_symbol>(code_length - 1 - padding_length - erasure_list[i]));
+               const int degree = ++workspace.lambda_degree;
+
+               for (int j = degree; j > 0; --j)
+               {
+                  lambda[j] ^= field_.mul(root, lambda[j - 1]);
+               }
+            }
+         }
+
+         inline galois::field_symbol evaluate(const galois::field_symbol poly[], const int degree, const galois::field_symbol x) const
+         {
+            galois::field_symbol result = 0;
+
+            for (int i = degree; i >= 0; --i)
+            {
+               result = field_.mul(result, x) ^ poly[i];
+            }
+
+            return result;
+         }
+
+         void find_roots(workspace_type& workspace, const std::size_t padding_length) const
          {
             /*
                Chien Search: Find the roots of the error locator polynomial
-               via an exhaustive search over all non-zero elements in the
-               given finite field.
+               over all non-zero elements in the given finite field. Error
+               locators of degree one and two are solved in closed form.
+               Only positions beyond the padding length are searched, roots
+               among the implied zeros of a shortened block are not errors
+               that can be corrected, and so are left out.
             */
 
-            root_list.reserve(fec_length << 1);
-            root_list.resize(0);
+            workspace.error_count = 0;
+
+            const int polynomial_degree = workspace.lambda_degree;
 
-            const std::size_t polynomial_degree = poly.deg();
+            if (polynomial_degree < 1)
+               return;
+            else if (1 == polynomial_degree)
+               find_linear_root(workspace, padding_length);
+            else if (2 == polynomial_degree)
+               find_quadratic_roots(workspace, padding_length);
+            else if (!chien_table_.empty() && (polynomial_degree <= static_cast<int>(fec_length)))
+               find_roots_interleaved(workspace, padding_length);
+            else
+               find_roots_incremental(workspace, padding_length);
+         }
 
-            for (int i = 1; i <= static_cast<int>(code_length); ++i)
+         inline int root_position(const galois::field_symbol root) const
+         {
+            /*
+               The Chien search position i of a root, that is the i in
+               [1,code_length] for which root = alpha^i
+            */
+            const galois::field_symbol position = field_.index(root);
+            return (0 == position) ? static_cast<int>(code_length) : position;
+         }
+
+         inline void add_root(workspace_type& workspace, const int position, const std::size_t padding_length) const
+         {
+            if (position > static_cast<int>(padding_length))
             {
-               if (0 == poly(field_.alpha(i)).poly())
+               workspace.error_location[workspace.error_count++] = position;
+            }
+         }
+
+         void find_linear_root(workspace_type& workspace, const std::size_t padding_length) const
+         {
+            const galois::field_symbol root = field_.div(workspace.lambda[0], workspace.lambda[1]);
+
+            if (0 != root)
+            {
+               add_root(workspace, root_position(root), padding_length);
+            }
+         }
+
+         void find_quadratic_roots(workspace_type& workspace, const std::size_t padding_length) const
+         {
+            const galois::field_symbol a = workspace.lambda[2];
+            const galois::field_symbol b = workspace.lambda[1];
+            const galois::field_symbol c = workspace.lambda[0];
+
+            if (0 == c)
+            {
+               /*
+                  Zero is a root, the other (non-zero) root is b/a
+               */
+               if (0 != b)
                {
-                  root_list.push_back(i);
+                  add_root(workspace, root_position(field_.div(b,a)), padding_length);
+               }
 
-                  if (polynomial_degree == root_list.size())
-                  {
-                     break;
-                  }
+               return;
+            }
+            else if (0 == b)
+            {
+               /*
+                  A repeated root, being the square root of c/a. As the
+                  multiplicative group is of odd order, alpha^k has the
+                  square root alpha^(k/2) or alpha^((k + code_length)/2).
+               */
+               const galois::field_symbol k = field_.index(field_.div(c,a));
+
+               add_root(workspace,
+                        root_position(field_.alpha((k & 1) ? ((k + static_cast<galois::field_symbol>(code_length)) >> 1) : (k >> 1))),
+                        padding_length);
+
+               return;
+            }
+
+            /*
+               Substituting x = (b/a).y gives y^2 + y + (a.c/b^2) = 0
+            */
+            const galois::field_symbol y = quadratic_root_table_[field_.div(field_.mul(a,c),field_.mul(b,b))];
+
+            if (y < 0)
+               return;
+
+            const galois::field_symbol scale = field_.div(b,a);
+
+            int position[2] = {
+                                 root_position(field_.mul(scale, y    )),
+                                 root_position(field_.mul(scale, y ^ 1))
+                              };
+
+            if (position[0] > position[1])
+            {
+               std::swap(position[0],position[1]);
+            }
+
+            add_root(workspace, position[0], padding_length);
+            add_root(workspace, position[1], padding_length);
+         }
+
+         void find_roots_interleaved(workspace_type& workspace, const std::size_t padding_length) const
+         {
+            /*
+               Evaluate the error locator at every candidate position at
+               once: value[i - 1] = sum over j of lambda[j].alpha^(j.i)
+            */
+            const int         polynomial_degree = workspace.lambda_degree;
+            const std::size_t length            = code_length - padding_length;
+
+            unsigned char value[code_length];
+
+            std::memset(value + padding_length, static_cast<unsigned char>(workspace.lambda[0]), length);
+
+            for (int j = 1; j <= polynomial_degree; ++j)
+            {
+               region_.mul_add(workspace.lambda[j], &chien_table_[j * code_length + padding_length], value + padding_length, length);
+            }
+
+            const unsigned char* begin = value;
+            const unsigned char* end   = value + code_length;
+
+            for (const unsigned char* itr = begin + padding_length; (itr = std::find(itr, end, 0)) != end; ++itr)
+            {
+               workspace.error_location[workspace.error_count++] = static_cast<int>(itr - begin) + 1;
+
+               if (static_cast<std::size_t>(polynomial_degree) == workspace.error_count)
+               {
+                  break;
                }
             }
          }
 
-         void compute_discrepancy(galois::field_element&          discrepancy,
-                                  const galois::field_polynomial& lambda,
-                                  const galois::field_polynomial& syndrome,
-                                  const std::size_t&              l,
-                                  const std::size_t&              round) const
+         void find_roots_incremental(workspace_type& workspace, const std::size_t padding_length) const
          {
             /*
-               Compute the lambda discrepancy at the current round of BMA
+               Each term of the error locator is held in a register in log
+               form, and per step multiplied by alpha^j - being the addition
+               of j to its log - instead of re-evaluating the polynomial.
+               The registers start out advanced past the padding positions.
             */
+            const int polynomial_degree = workspace.lambda_degree;
+            const int field_size        = static_cast<int>(code_length);
 
-            const std::size_t upper_bound = std::min(static_cast<int>(l), lambda.deg());
+            int* term_log  = workspace.chien_register;
+            int* term_step = workspace.chien_step;
+            int  term_count = 0;
 
-            discrepancy = 0;
+            for (int j = 1; j <= polynomial_degree; ++j)
+            {
+               if (0 != workspace.lambda[j])
+               {
+                  term_step[term_count] = j % field_size;
+                  term_log [term_count] = static_cast<int>((field_.index(workspace.lambda[j]) + term_step[term_count] * padding_length) % field_size);
+                  ++term_count;
+               }
+            }
 
-            for (std::size_t i = 0; i <= upper_bound; ++i)
+            for (int i = static_cast<int>(padding_length) + 1; i <= field_size; ++i)
             {
-               discrepancy += lambda[i] * syndrome[round - i];
+               galois::field_symbol sum = workspace.lambda[0];
+
+               for (int j = 0; j < term_count; ++j)
+               {
+                  term_log[j] += term_step[j];
+
+                  if (term_log[j] >= field_size)
+                     term_log[j] -= field_size;
+
+                  sum ^= field_.alpha(term_log[j]);
+               }
+
+               if (0 == sum)
+               {
+                  workspace.error_location[workspace.error_count++] = i;
+
+                  if (static_cast<std::size_t>(polynomial_degree) == workspace.error_count)
+                  {
+                     break;
+                  }
+               }
             }
          }
 
-         void modified_berlekamp_massey_algorithm(galois::field_polynomial&       lambda,
-                                                  const galois::field_polynomial& syndrome,
-                                                  const std::size_t               erasure_count) const
+         void modified_berlekamp_massey_algorithm(workspace_type& workspace, const std::size_t erasure_count) const
          {
             /*
                Modified Berlekamp-Massey Algorithm
                Identify the shortest length linear feed-back shift register (LFSR)
                that will generate the sequence equivalent to the syndrome.
+               The previous lambda is held pre-shifted by one, and all three
+               polynomials are zero filled beyond their degree.
             */
 
+            galois::field_symbol* lambda          = workspace.lambda;
+            galois::field_symbol* previous_lambda = workspace.previous_lambda;
+            galois::field_symbol* tau             = workspace.tau;
+            const galois::field_symbol* syndrome  = workspace.syndrome;
+
+            const int capacity = workspace_type::polynomial_capacity;
+
             int i = -1;
             std::size_t l = erasure_count;
 
-            galois::field_element discrepancy(field_,0);
-            galois::field_polynomial previous_lambda = lambda << 1;
+            std::fill_n(previous_lambda, capacity, galois::field_symbol(0));
+            std::copy(lambda, lambda + workspace.lambda_degree + 1, previous_lambda + 1);
+
+            int previous_degree = workspace.lambda_degree + 1;
 
             for (std::size_t round = erasure_count; round < fec_length; ++round)
             {
-               compute_discrepancy(discrepancy, lambda, syndrome, l, round);
+               if (workspace.lambda_degree < 0)
+                  break;
 
-               if (discrepancy != 0)
+               /*
+                  Compute the lambda discrepancy at the current round of BMA
+               */
+               const std::size_t upper_bound = std::min(l, static_cast<std::size_t>(workspace.lambda_degree));
+
+               galois::field_symbol discrepancy = 0;
+
+               for (std::size_t j = 0; j <= upper_bound; ++j)
                {
-                  galois::field_polynomial tau = lambda - (discrepancy * previous_lambda);
+                  discrepancy ^= field_.mul(lambda[j], syndrome[round - j]);
+               }
+
+               if (0 != discrepancy)
+               {
+                  const int upper_degree = std::max(workspace.lambda_degree, previous_degree);
+
+                  for (int j = 0; j <= upper_degree; ++j)
+                  {
+                     tau[j] = lambda[j] ^ field_.mul(discrepancy, previous_lambda[j]);
+                  }
 
                   if (static_cast<int>(l) < (static_cast<int>(round) - i))
                   {
                      const std::size_t tmp = round - i;
                      i = static_cast<int>(round - l);
                      l = tmp;
-                     previous_lambda = lambda / discrepancy;
+
+                     const galois::field_symbol inverse = field_.inverse(discrepancy);
+
+                     std::fill_n(previous_lambda, capacity, galois::field_symbol(0));
+
+                     for (int j = 0; j <= workspace.lambda_degree; ++j)
+                     {
+                        previous_lambda[j] = field_.mul(lambda[j], inverse);
+                     }
+
+                     previous_degree = workspace.lambda_degree;
+                  }
+
+                  int tau_degree = upper_degree;
+
+                  while ((tau_degree >= 0) && (0 == tau[tau_degree]))
+                  {
+                     --tau_degree;
+                  }
+
+                  std::fill_n(lambda, capacity, galois::field_symbol(0));
+                  std::copy(tau, tau + tau_degree + 1, lambda);
+
+                  workspace.lambda_degree = tau_degree;
+               }
+
+               std::copy_backward(previous_lambda, previous_lambda + previous_degree + 1, previous_lambda + previous_degree + 2);
+               previous_lambda[0] = 0;
+               ++previous_degree;
+            }
+         }
+
+         void compute_omega(workspace_type& workspace) const
+         {
+            /*
+               Error evaluator for the Forney algorithm:
+               omega(x) = (lambda(x) * syndrome(x)) mod x^fec_length
+            */
+            const galois::field_symbol* lambda        = workspace.lambda;
+            const galois::field_symbol* syndrome      = workspace.syndrome;
+            galois::field_symbol*       omega         = workspace.omega;
+            const int                   lambda_degree = workspace.lambda_degree;
+
+            for (std::size_t t = 0; t < fec_length; ++t)
+            {
+               galois::field_symbol term = 0;
+               const std::size_t lower_bound = (t > static_cast<std::size_t>(lambda_degree)) ? t - lambda_degree : 0;
+
+               for (std::size_t u = lower_bound; u <= t; ++u)
+               {
+                  term ^= field_.mul(lambda[t - u], syndrome[u]);
+               }
+
+               omega[t] = term;
+            }
+         }
+
+         void euclidean_algorithm(workspace_type& workspace, const std::size_t erasure_count) const
+         {
+            /*
+               Extended Euclidean (Sugiyama) Algorithm
+               With the erasure locator gamma already in lambda, divide
+               x^fec_length and T(x) = (gamma(x) * syndrome(x)) mod x^fec_length
+               one leading term at a time, carrying along the multiplier u
+               of T, until the remainder r satisfies 2.deg(r) < fec_length
+               + erasure_count. Then u is the error locator and r is
+               (u * T) mod x^fec_length, so that lambda = u * gamma and
+               omega = r, both scaled such that lambda(0) = 1.
+            */
+            galois::field_symbol* lambda = workspace.lambda;
+
+            galois::field_symbol* r0 = workspace.previous_remainder;
+            galois::field_symbol* r1 = workspace.remainder;
+            galois::field_symbol* u0 = workspace.previous_lambda;
+            galois::field_symbol* u1 = workspace.tau;
+
+            const int capacity    = workspace_type::polynomial_capacity;
+            const int gamma_degree = workspace.lambda_degree;
+
+            std::fill_n(r0, fec_length + 1, galois::field_symbol(0));
+            std::fill_n(r1, fec_length + 1, galois::field_symbol(0));
+            std::fill_n(u0, capacity, galois::field_symbol(0));
+            std::fill_n(u1, capacity, galois::field_symbol(0));
+
+            r0[fec_length] = 1;
+            u1[0]          = 1;
+
+            int r0_degree = static_cast<int>(fec_length);
+            int r1_degree = -1;
+            int u0_degree = -1;
+            int u1_degree = 0;
+
+            for (std::size_t t = 0; t < fec_length; ++t)
+            {
+               galois::field_symbol term = 0;
+               const std::size_t lower_bound = (t > static_cast<std::size_t>(gamma_degree)) ? t - gamma_degree : 0;
+
+               for (std::size_t u = lower_bound; u <= t; ++u)
+               {
+                  term ^= field_.mul(lambda[t - u], workspace.syndrome[u]);
+               }
+
+               r1[t] = term;
+
+               if (0 != term)
+                  r1_degree = static_cast<int>(t);
+            }
+
+            const int stop_degree = static_cast<int>(fec_length + erasure_count);
+
+            while ((r1_degree >= 0) && ((2 * r1_degree) >= stop_degree))
+            {
+               const galois::field_symbol inverse = field_.inverse(r1[r1_degree]);
+
+               while (r0_degree >= r1_degree)
+               {
+                  const int                  shift = r0_degree - r1_degree;
+                  const galois::field_symbol scale = field_.mul(r0[r0_degree], inverse);
+
+                  for (int j = 0; j <= r1_degree; ++j)
+                  {
+                     r0[j + shift] ^= field_.mul(scale, r1[j]);
                   }
 
-                  lambda = tau;
+                  for (int j = 0; j <= u1_degree; ++j)
+                  {
+                     u0[j + shift] ^= field_.mul(scale, u1[j]);
+                  }
+
+                  u0_degree = std::max(u0_degree, u1_degree + shift);
+
+                  while ((r0_degree >= 0) && (0 == r0[r0_degree]))
+                  {
+                     --r0_degree;
+                  }
+               }
+
+               while ((u0_degree >= 0) && (0 == u0[u0_degree]))
+               {
+                  --u0_degree;
                }
 
-               previous_lambda <<= 1;
+               std::swap(r0,r1);
+               std::swap(u0,u1);
+               std::swap(r0_degree,r1_degree);
+               std::swap(u0_degree,u1_degree);
+            }
+
+            /*
+               lambda = u1 * gamma, formed in place from the highest term
+               down, as term j only reads the gamma terms at or below j.
+            */
+            const int degree = u1_degree + gamma_degree;
+
+            for (int j = degree; j >= 0; --j)
+            {
+               galois::field_symbol term = 0;
+
+               for (int k = std::max(0, j - gamma_degree); k <= std::min(j, u1_degree); ++k)
+               {
+                  term ^= field_.mul(u1[k], lambda[j - k]);
+               }
+
+               lambda[j] = term;
+            }
+
+            std::fill(lambda + degree + 1, lambda + capacity, galois::field_symbol(0));
+
+            workspace.lambda_degree = degree;
+
+            if ((0 == lambda[0]) || (r1_degree >= degree))
+            {
+               /*
+                  No valid locator, or an evaluator of degree not below
+                  that of the locator, which can only be due to more errors
+                  than can be corrected. Leave a locator without roots.
+               */
+               workspace.lambda_degree = 0;
+               std::fill_n(lambda, capacity, galois::field_symbol(0));
+               lambda[0] = 1;
+               std::fill_n(workspace.omega, fec_length, galois::field_symbol(0));
+
+               return;
+            }
+
+            const galois::field_symbol normaliser = field_.inverse(lambda[0]);
+
+            for (int j = 0; j <= degree; ++j)
+            {
+               lambda[j] = field_.mul(lambda[j], normaliser);
+            }
+
+            for (std::size_t j = 0; j < fec_length; ++j)
+            {
+               workspace.omega[j] = (static_cast<int>(j) <= r1_degree) ? field_.mul(r1[j], normaliser) : 0;
             }
          }
 
-         bool forney_algorithm(const std::vector<int>&         error_locations,
-                               const galois::field_polynomial& lambda,
-                               const galois::field_polynomial& syndrome,
-                               block_type&                     rsblock) const
+         template <typename Block>
+         bool forney_algorithm(workspace_type& workspace, Block& rsblock) const
          {
             /*
-               The Forney algorithm for computing the error magnitudes
+               The Forney algorithm for computing the error magnitudes,
+               given lambda and omega. Error locations are positions in the
+               full length code, and so are offset by the padding length.
             */
-            const galois::field_polynomial omega = (lambda * syndrome) % fec_length;
-            const galois::field_polynomial lambda_derivative = lambda.derivative();
+            const std::size_t padding = implied_padding<Block>();
+
+            const galois::field_symbol* lambda        = workspace.lambda;
+            const galois::field_symbol* omega         = workspace.omega;
+            const int                   lambda_degree = workspace.lambda_degree;
 
             rsblock.errors_corrected = 0;
             rsblock.zero_numerators  = 0;
 
-            for (std::size_t i = 0; i < error_locations.size(); ++i)
+            for (std::size_t i = 0; i < workspace.error_count; ++i)
             {
-               const unsigned int         error_location = error_locations[i];
+               const unsigned int         error_location = workspace.error_location[i];
                const galois::field_symbol alpha_inverse  = field_.alpha(error_location);
-               const galois::field_symbol numerator      = (omega(alpha_inverse) * root_exponent_table_[error_location]).poly();
-               const galois::field_symbol denominator    = lambda_derivative(alpha_inverse).poly();
+               const galois::field_symbol numerator      = field_.mul(evaluate(omega, static_cast<int>(fec_length) - 1, alpha_inverse),
+                                                                      root_exponent_table_[error_location]);
+
+               /*
+                  The formal derivative of lambda retains only its odd
+                  terms, hence evaluate those over alpha_inverse^2.
+               */
+               const galois::field_symbol alpha_inverse_sqr = field_.mul(alpha_inverse, alpha_inverse);
+                     galois::field_symbol denominator       = 0;
+
+               for (int j = ((lambda_degree & 1) ? lambda_degree : lambda_degree - 1); j > 0; j -= 2)
+               {
+                  denominator = field_.mul(denominator, alpha_inverse_sqr) ^ lambda[j];
+               }
 
                if (0 != numerator)
                {
                   if (0 != denominator)
                   {
-                     rsblock[error_location - 1] ^= field_.div(numerator, denominator);
+                     rsblock[error_location - 1 - padding] ^= field_.div(numerator, denominator);
                      rsblock.errors_corrected++;
                   }
                   else
                   {
                      rsblock.unrecoverable = true;
-                     rsblock.error         = block_type::e_decoder_error3;
+                     rsblock.error         = Block::e_decoder_error3;
                      return false;
                   }
                }
@@ -372,12 +1294,12 @@ namespace schifra
                   ++rsblock.zero_numerators;
             }
 
-            if (lambda.deg() == static_cast<int>(rsblock.errors_detected))
+            if (lambda_degree == static_cast<int>(rsblock.errors_detected))
                return true;
             else
             {
                rsblock.unrecoverable = true;
-               rsblock.error         = block_type::e_decoder_error4;
+               rsblock.error         = Block::e_decoder_error4;
                return false;
             }
          }
@@ -388,11 +1310,20 @@ namespace schifra
          const galois::field&                  field_;
          std::vector<galois::field_symbol>     root_exponent_table_;
          std::vector<galois::field_symbol>     syndrome_exponent_table_;
-         std::vector<galois::field_polynomial> gamma_table_;
          const galois::field_polynomial        X_;
          const unsigned int                    gen_initial_index_;
+         const key_equation_solver_t           key_equation_solver_;
+         const galois::region_multiplier       region_;
+         std::vector<galois::field_symbol>     quadratic_root_table_;
+         std::vector<unsigned char>            syndrome_table_;
+         std::vector<unsigned char>            chien_table_;
+
+         static const std::size_t interleaved_tile_rows = 256;
       };
 
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length>
+      const std::size_t decoder<code_length,fec_length,data_length>::interleaved_tile_rows;
+
       template <std::size_t code_length,
                 std::size_t fec_length,
                 std::size_t data_length    = code_length - fec_length,
@@ -405,76 +1336,34 @@ namespace schifra
          typedef traits::reed_solomon_triat<code_length,fec_length,data_length> trait;
          typedef block<code_length,fec_length> block_type;
 
-         shortened_decoder(const galois::field& field, const unsigned int gen_initial_index = 0)
-         : decoder_(field, gen_initial_index)
+         typedef decoder<natural_length,fec_length> natural_decoder_type;
+         typedef typename natural_decoder_type::workspace_type workspace_type;
+         typedef typename natural_decoder_type::key_equation_solver_t key_equation_solver_t;
+
+         shortened_decoder(const galois::field& field,
+                           const unsigned int gen_initial_index = 0,
+                           const key_equation_solver_t key_equation_solver = natural_decoder_type::e_berlekamp_massey)
+         : decoder_(field, gen_initial_index, key_equation_solver)
          {}
 
          inline bool decode(block_type& rsblock, const erasure_locations_t& erasure_list) const
          {
-            typename natural_decoder_type::block_type block;
-
-            std::fill_n(&block[0], padding_length, typename block_type::symbol_type(0));
-
-            for (std::size_t i = 0; i < code_length; ++i)
-            {
-               block.data[padding_length + i] = rsblock.data[i];
-            }
-
-            erasure_locations_t shifted_position_erasure_list(erasure_list.size(),0);
-
-            for (std::size_t i = 0; i < erasure_list.size(); ++i)
-            {
-               shifted_position_erasure_list[i] = erasure_list[i] + padding_length;
-            }
-
-            if (decoder_.decode(block, shifted_position_erasure_list))
-            {
-               for (std::size_t i = 0; i < code_length; ++i)
-               {
-                  rsblock.data[i] = block.data[padding_length + i];
-               }
+            workspace_type workspace;
+            return decoder_.decode_shortened(rsblock, erasure_list, workspace);
+         }
 
-               rsblock.copy_state(block);
-               return true;
-            }
-            else
-            {
-               rsblock.copy_state(block);
-               return false;
-            }
+         inline bool decode(block_type& rsblock, const erasure_locations_t& erasure_list, workspace_type& workspace) const
+         {
+            return decoder_.decode_shortened(rsblock, erasure_list, workspace);
          }
 
          inline bool decode(block_type& rsblock) const
          {
-            typename natural_decoder_type::block_type block;
-
-            std::fill_n(&block[0], padding_length, typename block_type::symbol_type(0));
-
-            for (std::size_t i = 0; i < code_length; ++i)
-            {
-               block.data[padding_length + i] = rsblock.data[i];
-            }
-
-            if (decoder_.decode(block))
-            {
-               for (std::size_t i = 0; i < code_length; ++i)
-               {
-                  rsblock.data[i] = block.data[padding_length + i];
-               }
-
-               rsblock.copy_state(block);
-               return true;
-            }
-            else
-            {
-               rsblock.copy_state(block);
-               return false;
-            }
+            return decoder_.decode_shortened(rsblock);
          }
 
       private:
 
-         typedef decoder<natural_length,fec_length> natural_decoder_type;
          const natural_decoder_type decoder_;
       };
 
@@ -0,0 +1,316 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_DECODER_PROFILE_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_DECODER_PROFILE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <iomanip>
+#include <ostream>
+
+#if defined(SCHIFRA_DECODER_PROFILE)
+   #if !defined(__GNUC__) && !defined(__clang__)
+      #error "SCHIFRA_DECODER_PROFILE requires GCC or Clang thread local storage and atomic builtins"
+   #endif
+
+   #if !defined(__x86_64__) && !defined(__i386__)
+      #include <time.h>
+   #endif
+#endif
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Optional per-stage decoder instrumentation, compiled in only when
+         SCHIFRA_DECODER_PROFILE is defined, and otherwise reduced to
+         nothing. Each thread counts into a profile of its own without any
+         synchronisation. decode_part merges the calling thread's profile
+         into a process wide total at the end of every part, so after a
+         file decode the total covers all of the worker threads.
+
+         Cycles are read from the time stamp counter on x86, elsewhere
+         they are nanoseconds of the monotonic clock.
+      */
+      struct decoder_profile
+      {
+         /* The key equation stage is either solver, see decoder::key_equation_solver_t. */
+         enum stage_t
+         {
+            e_syndrome         = 0,
+            e_key_equation     = 1,
+            e_chien_search     = 2,
+            e_forney           = 3,
+            stage_count        = 4
+         };
+
+         /* Blocks with this many or more errors share the last bucket. */
+         enum { histogram_size = 256 };
+
+         unsigned long long cycles       [stage_count];
+         unsigned long long calls        [stage_count];
+         unsigned long long error_histogram[histogram_size];
+         unsigned long long unrecoverable;
+
+         inline void clear()
+         {
+            std::fill_n(cycles         , static_cast<std::size_t>(stage_count   ), 0ULL);
+            std::fill_n(calls          , static_cast<std::size_t>(stage_count   ), 0ULL);
+            std::fill_n(error_histogram, static_cast<std::size_t>(histogram_size), 0ULL);
+            unrecoverable = 0;
+         }
+
+         inline void add(const decoder_profile& profile)
+         {
+            for (std::size_t i = 0; i < stage_count; ++i)
+            {
+               cycles[i] += profile.cycles[i];
+               calls [i] += profile.calls [i];
+            }
+
+            for (std::size_t i = 0; i < histogram_size; ++i)
+            {
+               error_histogram[i] += profile.error_histogram[i];
+            }
+
+            unrecoverable += profile.unrecoverable;
+         }
+
+         inline unsigned long long block_count() const
+         {
+            unsigned long long count = 0;
+
+            for (std::size_t i = 0; i < histogram_size; ++i)
+            {
+               count += error_histogram[i];
+            }
+
+            return count;
+         }
+
+         static inline const char* stage_name(const std::size_t stage)
+         {
+            static const char* name[stage_count] = { "syndrome", "key_equation", "chien_search", "forney" };
+            return name[stage];
+         }
+
+         inline void dump(std::ostream& stream) const
+         {
+            unsigned long long total_cycles = 0;
+
+            for (std::size_t i = 0; i < stage_count; ++i)
+            {
+               total_cycles += cycles[i];
+            }
+
+            stream << "Decoder profile - blocks: " << block_count() << "  unrecoverable: " << unrecoverable << "\n";
+
+            for (std::size_t i = 0; i < stage_count; ++i)
+            {
+               char ratio[64];
+
+               std::sprintf(ratio,"  cycles/call: %10.1f  share: %6.2f%%",
+                            (calls[i] > 0) ? (static_cast<double>(cycles[i]) / calls[i]) : 0.0,
+                            (total_cycles > 0) ? ((100.0 * cycles[i]) / total_cycles) : 0.0);
+
+               stream << "   " << std::left  << std::setw(18) << stage_name(i)
+                      << " calls: "  << std::right << std::setw(12) << calls [i]
+                      << "  cycles: "              << std::setw(16) << cycles[i]
+                      << ratio << "\n";
+            }
+
+            stream << "   errors detected per block:\n";
+
+            for (std::size_t i = 0; i < histogram_size; ++i)
+            {
+               if (0 == error_histogram[i])
+                  continue;
+
+               stream << "      " << std::right << std::setw(3) << i
+                      << (((i + 1) == histogram_size) ? "+ " : "  ")
+                      << std::setw(12) << error_histogram[i] << "\n";
+            }
+         }
+      };
+
+      #if defined(SCHIFRA_DECODER_PROFILE)
+
+      inline unsigned long long read_cycle_counter()
+      {
+         #if defined(__x86_64__) || defined(__i386__)
+            return __builtin_ia32_rdtsc();
+         #else
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC,&now);
+            return (static_cast<unsigned long long>(now.tv_sec) * 1000000000ULL) + now.tv_nsec;
+         #endif
+      }
+
+      /* The profile of the calling thread, zero initialised on first use. */
+      inline decoder_profile& local_decoder_profile()
+      {
+         static __thread decoder_profile profile;
+         return profile;
+      }
+
+      struct decoder_profile_total
+      {
+         decoder_profile profile;
+         int             lock;
+      };
+
+      inline decoder_profile_total& global_decoder_profile()
+      {
+         static decoder_profile_total total;
+         return total;
+      }
+
+      /* Merge the calling thread's profile into the process wide total. */
+      inline void flush_decoder_profile()
+      {
+         decoder_profile&       local = local_decoder_profile();
+         decoder_profile_total& total = global_decoder_profile();
+
+         while (__sync_lock_test_and_set(&total.lock,1)) {}
+
+         total.profile.add(local);
+
+         __sync_lock_release(&total.lock);
+
+         local.clear();
+      }
+
+      /* The process wide total, including the calling thread's unflushed counts. */
+      inline decoder_profile decoder_profile_snapshot()
+      {
+         flush_decoder_profile();
+
+         decoder_profile_total& total = global_decoder_profile();
+         decoder_profile snapshot;
+
+         while (__sync_lock_test_and_set(&total.lock,1)) {}
+
+         snapshot = total.profile;
+
+         __sync_lock_release(&total.lock);
+
+         return snapshot;
+      }
+
+      inline void reset_decoder_profile()
+      {
+         decoder_profile_total& total = global_decoder_profile();
+
+         local_decoder_profile().clear();
+
+         while (__sync_lock_test_and_set(&total.lock,1)) {}
+
+         total.profile.clear();
+
+         __sync_lock_release(&total.lock);
+      }
+
+      inline void record_decoded_block(const std::size_t errors_detected, const bool success)
+      {
+         decoder_profile& profile = local_decoder_profile();
+
+         ++profile.error_histogram[std::min<std::size_t>(errors_detected, decoder_profile::histogram_size - 1)];
+
+         if (!success)
+            ++profile.unrecoverable;
+      }
+
+      inline void record_clean_blocks(const std::size_t count)
+      {
+         local_decoder_profile().error_histogram[0] += count;
+      }
+
+      /* Attributes the cycles of its lifetime to one decoder stage. */
+      class decoder_stage_timer
+      {
+      public:
+
+         explicit decoder_stage_timer(const decoder_profile::stage_t stage)
+         : stage_(stage),
+           start_(read_cycle_counter())
+         {}
+
+        ~decoder_stage_timer()
+         {
+            decoder_profile& profile = local_decoder_profile();
+
+            profile.cycles[stage_] += read_cycle_counter() - start_;
+            ++profile.calls[stage_];
+         }
+
+      private:
+
+         decoder_stage_timer(const decoder_stage_timer&);
+         decoder_stage_timer& operator=(const decoder_stage_timer&);
+
+         const decoder_profile::stage_t stage_;
+         const unsigned long long       start_;
+      };
+
+      #else
+
+      inline void flush_decoder_profile()
+      {}
+
+      inline decoder_profile decoder_profile_snapshot()
+      {
+         decoder_profile snapshot;
+         snapshot.clear();
+         return snapshot;
+      }
+
+      inline void reset_decoder_profile()
+      {}
+
+      inline void record_decoded_block(const std::size_t, const bool)
+      {}
+
+      inline void record_clean_blocks(const std::size_t)
+      {}
+
+      class decoder_stage_timer
+      {
+      public:
+
+         explicit decoder_stage_timer(const decoder_profile::stage_t)
+         {}
+      };
+
+      #endif
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
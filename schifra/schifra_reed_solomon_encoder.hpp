@@ -24,11 +24,16 @@
 #define INCLUDE_SCHIFRA_REED_SOLOMON_ENCODER_HPP
 
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "schifra_galois_field.hpp"
 #include "schifra_galois_field_element.hpp"
 #include "schifra_galois_field_polynomial.hpp"
+#include "schifra_galois_region_multiplier.hpp"
 #include "schifra_reed_solomon_block.hpp"
 #include "schifra_ecc_traits.hpp"
 
@@ -46,84 +51,279 @@ namespace schifra
 
          typedef traits::reed_solomon_triat<code_length, fec_length,data_length> trait;
          typedef block<code_length, fec_length> block_type;
+         typedef typename traits::symbol_storage<code_length>::type register_type;
 
          encoder(const galois::field& gfield, const galois::field_polynomial& generator)
          : encoder_valid_(code_length == gfield.size()),
+           generator_valid_(false),
            field_(gfield),
-           generator_(generator)
-         {}
+           region_(gfield)
+         {
+            if (encoder_valid_)
+            {
+               create_lookup_tables(generator);
+            }
+         }
 
         ~encoder()
          {}
 
          inline bool encode(block_type& rsblock) const
          {
-            if (!encoder_valid_)
+            return encode_block(rsblock);
+         }
+
+         inline bool encode(const std::string& data, block_type& rsblock) const
+         {
+            std::string::const_iterator itr  = data.begin();
+            const galois::field_symbol  mask = field_.mask();
+
+            for (std::size_t i = 0; i < data_length; ++i, ++itr)
+            {
+               rsblock.data[i] = static_cast<typename block_type::symbol_type>(*itr) & mask;
+            }
+
+            return encode(rsblock);
+         }
+
+         /*
+            Encode a codeword of this code shortened to shortened_length
+            symbols, that is with code_length - shortened_length leading
+            data symbols implied to be zero. As a zero feedback adds
+            nothing into the LFSR, those positions are never visited.
+         */
+         template <std::size_t shortened_length>
+         inline bool encode_shortened(block<shortened_length,fec_length>& rsblock) const
+         {
+            return encode_block(rsblock);
+         }
+
+         inline bool supports_interleaved() const
+         {
+            return encoder_valid_ && generator_valid_ && region_.valid();
+         }
+
+         /*
+            Encode row_count codewords held column-wise, such that
+            column[i][r] is symbol i of codeword r. The data_length data
+            columns are read and the fec_length parity columns written.
+            The LFSR is evaluated for many codewords at once, with every
+            feedback step being a region multiply-accumulate. Requires
+            byte sized symbols, see supports_interleaved().
+         */
+         inline bool encode_interleaved(unsigned char* const column[], const std::size_t row_count) const
+         {
+            if (!supports_interleaved())
             {
-               rsblock.error = block_type::e_encoder_error0;
                return false;
             }
 
-            const galois::field_polynomial parities = msg_poly(rsblock) % generator_;
-            const galois::field_symbol     mask     = field_.mask();
+            const std::size_t tile_rows = 256;
+
+            unsigned char feedback[tile_rows];
+            unsigned char window[fec_length][tile_rows];
 
-            if (parities.deg() == (fec_length - 1))
+            for (std::size_t offset = 0; offset < row_count; offset += tile_rows)
             {
-               for (std::size_t i = 0; i < fec_length; ++i)
+               const std::size_t rows = std::min(tile_rows, row_count - offset);
+
+               /*
+                  Positions below fec_length are only ever accumulated
+                  into, all others are first assigned by the feedback of
+                  the position fec_length before them.
+               */
+               std::memset(window, 0x00, sizeof(window));
+
+               for (std::size_t i = data_length; i < fec_length; ++i)
                {
-                  rsblock.fec(i) = parities[fec_length - 1 - i].poly() & mask;
+                  std::memset(column[i] + offset, 0x00, rows);
+               }
+
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  std::memcpy(feedback, column[i] + offset, rows);
+                  region_.add(window[i % fec_length], feedback, rows);
+
+                  for (std::size_t j = 0; j < fec_length; ++j)
+                  {
+                     const std::size_t position = i + 1 + j;
+
+                     unsigned char* w = (position < data_length) ?
+                                        window[position % fec_length] :
+                                        column[position] + offset;
+
+                     if ((fec_length - 1) == j)
+                        region_.mul    (generator_term_[j], feedback, w, rows);
+                     else
+                        region_.mul_add(generator_term_[j], feedback, w, rows);
+                  }
                }
             }
-            else
+
+            return true;
+         }
+
+      private:
+
+         encoder();
+         encoder(const encoder& enc);
+         encoder& operator=(const encoder& enc);
+
+         template <typename Block>
+         inline bool encode_block(Block& rsblock) const
+         {
+            /*
+               The block may be of a shortened code, whose data symbols
+               are those that follow the implied leading zeros.
+            */
+            const std::size_t shortened_data_length = Block::trait::data_length;
+
+            if (!encoder_valid_)
+            {
+               rsblock.error = Block::e_encoder_error0;
+               return false;
+            }
+            else if (!generator_valid_)
             {
                /*
-                  Note: Encoder should never branch here.
-                  Possible issues to look for:
+                  Note: Possible issues to look for:
                   1. Generator polynomial degree is not equivelent to fec length
                   2. Field and code length are not consistent.
-
                */
-               rsblock.error = block_type::e_encoder_error1;
+               rsblock.error = Block::e_encoder_error1;
                return false;
             }
 
+            /*
+               Systematic encoding via a linear feedback shift register,
+               unrolled over the codeword as a synthetic division: the
+               window accumulates the remainder of the message polynomial
+               divided by the (monic) generator polynomial, each feedback
+               symbol adding its scaled generator into the fec_length
+               positions that follow it.
+            */
+            register_type window[code_length];
+
+            std::fill_n(window, static_cast<std::size_t>(Block::trait::code_length), register_type(0));
+
+            const galois::field_symbol mask = field_.mask();
+
+            if (!generator_row_table_.empty())
+            {
+               for (std::size_t i = 0; i < shortened_data_length; ++i)
+               {
+                  const std::size_t    feedback = (rsblock.data[i] & mask) ^ window[i];
+                  const register_type* row      = &generator_row_table_[feedback * fec_length];
+                  register_type*       w        = &window[i + 1];
+
+                  for (std::size_t j = 0; j < fec_length; ++j)
+                  {
+                     w[j] ^= row[j];
+                  }
+               }
+            }
+            else
+            {
+               for (std::size_t i = 0; i < shortened_data_length; ++i)
+               {
+                  const std::size_t    feedback = (rsblock.data[i] & mask) ^ window[i];
+                  const register_type* term     = &alpha_table_[log_table_[feedback]];
+                  register_type*       w        = &window[i + 1];
+
+                  for (std::size_t j = 0; j < fec_length; ++j)
+                  {
+                     w[j] ^= term[generator_log_[j]];
+                  }
+               }
+            }
+
+            for (std::size_t i = 0; i < fec_length; ++i)
+            {
+               rsblock.fec(i) = window[shortened_data_length + i];
+            }
+
             return true;
          }
 
-         inline bool encode(const std::string& data, block_type& rsblock) const
+         void create_lookup_tables(const galois::field_polynomial& generator)
          {
-            std::string::const_iterator itr  = data.begin();
-            const galois::field_symbol  mask = field_.mask();
+            /*
+               Log-domain tables for the LFSR. The anti-log table spans
+               four times the code length so that the sum of two logs
+               never needs to be reduced, and a zero operand is given the
+               log value zero_log, which always lands in the zero filled
+               upper half - hence the feedback loop needs no branches.
+            */
+            if (generator.deg() != static_cast<int>(fec_length))
+               return;
 
-            for (std::size_t i = 0; i < data_length; ++i, ++itr)
+            const galois::field_symbol leading_term = generator[fec_length].poly();
+
+            if (0 == leading_term)
+               return;
+
+            const std::size_t zero_log = (code_length << 1) - 1;
+
+            alpha_table_.resize(code_length << 2, register_type(0));
+
+            for (std::size_t i = 0; i < zero_log; ++i)
             {
-               rsblock.data[i] = static_cast<typename block_type::symbol_type>(*itr) & mask;
+               alpha_table_[i] = static_cast<register_type>(field_.alpha(static_cast<galois::field_symbol>(i % code_length)));
             }
 
-            return encode(rsblock);
-         }
+            log_table_.resize(code_length + 1);
 
-      private:
+            log_table_[0] = zero_log;
 
-         encoder();
-         encoder(const encoder& enc);
-         encoder& operator=(const encoder& enc);
+            for (std::size_t i = 1; i <= code_length; ++i)
+            {
+               log_table_[i] = static_cast<std::size_t>(field_.index(static_cast<galois::field_symbol>(i)));
+            }
 
-         inline galois::field_polynomial msg_poly(const block_type& rsblock) const
-         {
-            galois::field_polynomial message(field_, code_length);
+            /*
+               Generator terms are held highest order first, the leading
+               term being implied.
+            */
+            for (std::size_t i = 0; i < fec_length; ++i)
+            {
+               const galois::field_symbol term = field_.div(generator[fec_length - 1 - i].poly(),leading_term);
+               generator_log_ [i] = log_table_[term];
+               generator_term_[i] = term;
+            }
 
-            for (std::size_t i = fec_length; i < code_length; ++i)
+            /*
+               For byte sized symbols the products of every possible
+               feedback symbol with the generator are tabulated, so that
+               each feedback becomes a single contiguous row xor.
+            */
+            if (1 == sizeof(register_type))
             {
-               message[i] = rsblock.data[code_length - 1 - i];
+               generator_row_table_.resize((code_length + 1) * fec_length);
+
+               for (std::size_t feedback = 0; feedback <= code_length; ++feedback)
+               {
+                  const register_type* term = &alpha_table_[log_table_[feedback]];
+                  register_type*       row  = &generator_row_table_[feedback * fec_length];
+
+                  for (std::size_t j = 0; j < fec_length; ++j)
+                  {
+                     row[j] = term[generator_log_[j]];
+                  }
+               }
             }
 
-            return message;
+            generator_valid_ = true;
          }
 
-         const bool                     encoder_valid_;
-         const galois::field&           field_;
-         const galois::field_polynomial generator_;
+         const bool                 encoder_valid_;
+         bool                       generator_valid_;
+         const galois::field&       field_;
+         std::vector<register_type> alpha_table_;
+         std::vector<std::size_t>   log_table_;
+         std::vector<register_type> generator_row_table_;
+         std::size_t                generator_log_[fec_length];
+         galois::field_symbol       generator_term_[fec_length];
+         galois::region_multiplier  region_;
       };
 
       template <std::size_t code_length,
@@ -137,7 +337,6 @@ namespace schifra
 
          typedef traits::reed_solomon_triat<code_length,fec_length,data_length> trait;
          typedef block<code_length,fec_length> block_type;
-         typedef block<natural_length,fec_length> short_block_t;
 
          shortened_encoder(const galois::field& gfield,
                            const galois::field_polynomial& generator)
@@ -146,50 +345,17 @@ namespace schifra
 
          inline bool encode(block_type& rsblock) const
          {
-            short_block_t block;
-
-            std::fill_n(&block[0], padding_length, typename block_type::symbol_type(0));
-
-            for (std::size_t i = 0; i < data_length; ++i)
-            {
-               block.data[padding_length + i] = rsblock.data[i];
-            }
-
-            if (encoder_.encode(block))
-            {
-               for (std::size_t i = 0; i < fec_length; ++i)
-               {
-                  rsblock.fec(i) = block.fec(i);
-               }
-
-               return true;
-            }
-            else
-               return false;
+            return encoder_.encode_shortened(rsblock);
          }
 
          inline bool encode(const std::string& data, block_type& rsblock) const
          {
-            short_block_t block;
-
-            std::fill_n(&block[0], padding_length, typename block_type::symbol_type(0));
-
             for (std::size_t i = 0; i < data_length; ++i)
             {
-               block.data[padding_length + i] = data[i];
+               rsblock.data[i] = static_cast<typename block_type::symbol_type>(data[i]);
             }
 
-            if (encoder_.encode(block))
-            {
-               for (std::size_t i = 0; i < code_length; ++i)
-               {
-                  rsblock.data[i] = block.data[padding_length + i];
-               }
-
-               return true;
-            }
-            else
-               return false;
+            return encoder_.encode_shortened(rsblock);
          }
 
       private:
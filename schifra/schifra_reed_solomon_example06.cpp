@@ -34,9 +34,7 @@
 #include <iostream>
 #include <string>
 
-#define NO_GFLUT
 #include "schifra_galois_field.hpp"
-#undef NO_GFLUT
 #include "schifra_galois_field_polynomial.hpp"
 #include "schifra_sequential_root_generator_polynomial_creator.hpp"
 #include "schifra_reed_solomon_encoder.hpp"
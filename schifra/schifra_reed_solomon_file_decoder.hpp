@@ -22,6 +22,8 @@
 #ifndef INCLUDE_SCHIFRA_REED_SOLOMON_FILE_DECODER_HPP
 #define INCLUDE_SCHIFRA_REED_SOLOMON_FILE_DECODER_HPP
 
+#include <algorithm>
+
 #include <iostream>
 
 #include <fstream>
@@ -52,11 +54,7 @@ namespace schifra {
                     const std::size_t rows = part_size_bytes / columns;
                     const std::size_t one_chunk_size_bytes = rows * code_length;
 
-                    char * fec_buffer_ = new char[fec_length];
-                    char ** chunk_data = new char * [rows];
                     bool remaining_bytes_exists = false;
-                    for (std::size_t i = 0; i < rows; ++i)
-                        chunk_data[i] = new char[code_length];
 
                     std::size_t file_size = schifra::fileio::file_size(input_file_name);
                     if (file_size == 0) {
@@ -76,6 +74,10 @@ namespace schifra {
                         return;
                     }
 
+                    char ** chunk_data = new char * [rows];
+                    for (std::size_t i = 0; i < rows; ++i)
+                        chunk_data[i] = new char[code_length];
+
                     for (std::size_t chunk = 0; chunk <= file_size / one_chunk_size_bytes; chunk++) {
                         std::size_t length = 0;
                         std::size_t remaining_bytes = 0;
@@ -109,72 +111,58 @@ namespace schifra {
 
                         for (std::size_t i = 0; i < index; ++i) {
                             if (remaining_bytes_exists && i == index - 1) {
-                                process_partial_block(decoder, chunk_data[i], out_stream, remaining_bytes);
+                                process_partial_block(decoder, chunk_data[i], remaining_bytes);
                                 out_stream.write( & chunk_data[i][0], static_cast < std::streamsize > (remaining_bytes - fec_length));
                             } else {
-                                process_complete_block(decoder, chunk_data[i], out_stream);
+                                process_complete_block(decoder, chunk_data[i]);
                                 out_stream.write( & chunk_data[i][0], static_cast < std::streamsize > (data_length));
                             }
                         }
                     }
                     in_stream.close();
                     out_stream.close();
+
+                    for (std::size_t i = 0; i < rows; ++i)
+                        delete[] chunk_data[i];
+                    delete[] chunk_data;
                 }
 
                 private:
 
                     inline void process_complete_block(const decoder_type & decoder,
-                        char * buffer_,
-                        std::ofstream & out_stream) {
-                        copy < char, code_length, fec_length > (buffer_, code_length, block_);
+                        char * buffer_) {
+                        copy(reinterpret_cast < const unsigned char * > (buffer_), code_length, block_);
 
                         if (!decoder.decode(block_)) {
                             std::cout << "reed_solomon::file_decoder.process_complete_block() - Error during decoding !" << std::endl;
                             return;
                         }
 
-                        for (std::size_t i = 0; i < data_length; ++i) {
-                            buffer_[i] = static_cast < char > (block_[i]);
-                            std::ofstream outdata ("example2.txt:,std::ios::app);
-                            outdata <<block_[i] <<std::endl;
-                            outdata.close();
-                              return;
-                            
-                        }
+                        std::copy(block_.data, block_.data + data_length, reinterpret_cast < unsigned char * > (buffer_));
 
                     }
 
                 inline void process_partial_block(const decoder_type & decoder,
                     char * buffer_,
-                    std::ofstream & out_stream,
                     const std::size_t & read_amount) {
                     if (read_amount <= fec_length) {
                         std::cout << "reed_solomon::file_decoder.process_partial_block() - Error during decoding !" << std::endl;
                         return;
                     }
 
-                    for (std::size_t i = 0; i < (read_amount - fec_length); ++i) {
-                        block_.data[i] = static_cast < typename block_type::symbol_type > (buffer_[i]);
-                    }
-
-                    if ((read_amount - fec_length) < data_length) {
-                        for (std::size_t i = (read_amount - fec_length); i < data_length; ++i) {
-                            block_.data[i] = 0;
-                        }
-                    }
+                    const std::size_t data_amount = read_amount - fec_length;
+                    const unsigned char * data = reinterpret_cast < const unsigned char * > (buffer_);
 
-                    for (std::size_t i = 0; i < fec_length; ++i) {
-                        block_.fec(i) = static_cast < typename block_type::symbol_type > (buffer_[(read_amount - fec_length) + i]);
-                    }
+                    std::copy(data, data + data_amount, block_.data);
+                    std::fill(block_.data + data_amount, block_.data + data_length, 0x00);
+                    std::copy(data + data_amount, data + read_amount, block_.data + data_length);
 
                     if (!decoder.decode(block_)) {
                         std::cout << "reed_solomon::file_decoder.process_partial_block() - Error during decoding !" << std::endl;
                         return;
                     }
 
-                    for (std::size_t i = 0; i < (read_amount - fec_length); ++i) {
-                        buffer_[i] = static_cast < char > (block_.data[i]);
-                    }
+                    std::copy(block_.data, block_.data + data_amount, reinterpret_cast < unsigned char * > (buffer_));
                 }
 
                 block_type block_;
@@ -35,11 +35,12 @@ int main()
    const std::size_t gen_poly_index      = 120;
    const std::size_t code_length         = 255;
    const std::size_t fec_length          =   6;
+   const std::size_t part_size_bytes     = 1024 * 1024;
    const std::string input_file_name     = "input.schifra";
    const std::string output_file_name    = "output.decoded";
 
    typedef schifra::reed_solomon::decoder<code_length,fec_length> decoder_t;
-   typedef schifra::reed_solomon::file_decoder<code_length,fec_length> file_decoder_t;
+   typedef schifra::reed_solomon::file_decoder<part_size_bytes,code_length,fec_length> file_decoder_t;
 
    const schifra::galois::field field(field_descriptor,
                                       schifra::galois::primitive_polynomial_size06,
@@ -47,7 +48,7 @@ int main()
 
    const decoder_t rs_decoder(field,gen_poly_index);
 
-   file_decoder_t(rs_decoder, input_file_name, output_file_name);
+   file_decoder_t file_decoder(rs_decoder, input_file_name, output_file_name);
 
    return 0;
 }
@@ -22,12 +22,16 @@
 #ifndef INCLUDE_SCHIFRA_REED_SOLOMON_FILE_ENCODER_HPP
 #define INCLUDE_SCHIFRA_REED_SOLOMON_FILE_ENCODER_HPP
 
+#include <algorithm>
+
 #include <cstring>
 
 #include <iostream>
 
 #include <fstream>
 
+#include <vector>
+
 #include "schifra_reed_solomon_block.hpp"
 
 #include "schifra_reed_solomon_encoder.hpp"
@@ -53,11 +57,6 @@ namespace schifra {
                     const std::size_t rows = part_size_bytes / columns;
                     const std::size_t one_chunk_size_bytes = rows * data_length;
 
-                    char * fec_buffer_ = new char[fec_length];
-                    char ** chunk_data = new char * [rows];
-                   
-                    bool remaining_bytes_exists = false;
-
                     std::size_t file_size = schifra::fileio::file_size(input_file_name);
                     if (file_size == 0) {
                         std::cout << "reed_solomon::file_encoder() - Error: input file has ZERO size." << std::endl;
@@ -77,53 +76,62 @@ namespace schifra {
                         return;
                     }
 
+                    /*
+                       Each part is read with a single read, transposed into a
+                       contiguous output buffer and emitted with a single write.
+                    */
+                    std::vector < char > input_buffer(one_chunk_size_bytes);
+                    std::vector < char > output_buffer(rows * code_length);
+
                     for (std::size_t chunk = 0; chunk <= file_size / one_chunk_size_bytes; chunk++) {
                         std::size_t length = 0;
-                        std::size_t remaining_bytes = 0;
 
                         if (file_size - (chunk * one_chunk_size_bytes) >= one_chunk_size_bytes) {
                             length = one_chunk_size_bytes;
-                            remaining_bytes = length;
                         } else {
                             length = file_size - (chunk * one_chunk_size_bytes);
-                            remaining_bytes = length;
                         }
 
-                        std::size_t index = 0;
-                       
-                        while (remaining_bytes >= data_length) {
-                            chunk_data[index] = new char[code_length];
-                            in_stream.read( & chunk_data[index][0], static_cast < std::streamsize > (data_length));
-                            process_block(encoder, out_stream, chunk_data[index], fec_buffer_, data_length);
-                            remaining_bytes -= data_length;
-                            index++;
+                        if (length == 0) {
+                            break;
                         }
 
-                        if (remaining_bytes > 0) {
-                            remaining_bytes_exists = true;
-                            chunk_data[index] = new char[remaining_bytes + fec_length];
-                            in_stream.read( & chunk_data[index][0], static_cast < std::streamsize > (remaining_bytes));
-                            process_block(encoder, out_stream, chunk_data[index], fec_buffer_, remaining_bytes);
-                            index++;
+                        in_stream.read( & input_buffer[0], static_cast < std::streamsize > (length));
+                        if (static_cast < std::size_t > (in_stream.gcount()) != length) {
+                            std::cout << "reed_solomon::file_encoder() - Error: input file could not be read." << std::endl;
+                            return;
                         }
-                        if (remaining_bytes_exists) {
-                            for (std::size_t i = 0; i < code_length; ++i) {
-                                for (std::size_t j = 0; j < index - 1; ++j) {
-                                    out_stream << chunk_data[j][i];
-                                }
-                            }
-                            for (std::size_t i = 0; i < remaining_bytes + fec_length; ++i) {
 
-                                out_stream << chunk_data[index - 1][i];
-                            }
-                        } else {
+                        const std::size_t full_rows = length / data_length;
+                        const std::size_t remaining_bytes = length % data_length;
+
+                        for (std::size_t j = 0; j < full_rows; ++j) {
+                            const char * data_buffer_ = & input_buffer[j * data_length];
+                            process_block(encoder, data_buffer_, data_length);
 
-                            for (std::size_t i = 0; i < code_length; ++i) {
-                                for (std::size_t j = 0; j < index; ++j) {
-                                    out_stream << chunk_data[j][i];
-                                }
+                            for (std::size_t i = 0; i < data_length; ++i) {
+                                output_buffer[(i * full_rows) + j] = data_buffer_[i];
                             }
+                            for (std::size_t i = 0; i < fec_length; ++i) {
+                                output_buffer[((data_length + i) * full_rows) + j] = fec_buffer_[i];
+                            }
+                        }
+
+                        std::size_t output_length = full_rows * code_length;
 
+                        if (remaining_bytes > 0) {
+                            const char * data_buffer_ = & input_buffer[full_rows * data_length];
+                            process_block(encoder, data_buffer_, remaining_bytes);
+
+                            std::copy(data_buffer_, data_buffer_ + remaining_bytes, & output_buffer[output_length]);
+                            std::copy(fec_buffer_, fec_buffer_ + fec_length, & output_buffer[output_length + remaining_bytes]);
+                            output_length += remaining_bytes + fec_length;
+                        }
+
+                        out_stream.write( & output_buffer[0], static_cast < std::streamsize > (output_length));
+                        if (!out_stream) {
+                            std::cout << "reed_solomon::file_encoder() - Error: output file could not be written." << std::endl;
+                            return;
                         }
                     }
 
@@ -134,36 +142,24 @@ namespace schifra {
                 private:
 
                     inline void process_block(const encoder_type & encoder,
-                        std::ofstream & out_stream,
-                        char * data_buffer_,
-                        char * fec_buffer_,
+                        const char * data_buffer_,
                         const std::size_t & read_amount) {
-                        
-                        
-                        for (std::size_t i = 0; i < read_amount; ++i) {
-                            block_.data[i] = (data_buffer_[i] & 0xFF);
-                        }
-                        if (read_amount < data_length) {
-                            for (std::size_t i = read_amount; i < data_length; ++i) {
-                                block_.data[i] = 0x00;
-                            }
-                        }
+
+                        const unsigned char * data = reinterpret_cast < const unsigned char * > (data_buffer_);
+
+                        std::copy(data, data + read_amount, block_.data);
+                        std::fill(block_.data + read_amount, block_.data + data_length, 0x00);
 
                         if (!encoder.encode(block_)) {
                             std::cout << "reed_solomon::file_encoder.process_block() - Error during encoding of block!" << std::endl;
                             return;
                         }
 
-                        for (std::size_t i = 0; i < fec_length; ++i) {
-                            fec_buffer_[i] = static_cast < char > (block_.fec(i) & 0xFF);
-                        }
-
-                        for (std::size_t i = 0, j = read_amount; i < fec_length; ++i, ++j) {
-                            data_buffer_[j] = fec_buffer_[i];
-                        }
+                        std::copy(block_.data + data_length, block_.data + code_length, reinterpret_cast < unsigned char * > (fec_buffer_));
                     }
 
                 block_type block_;
+                char fec_buffer_[fec_length];
               
             };
 
@@ -36,11 +36,12 @@ int main()
    const std::size_t gen_poly_root_count =   6;
    const std::size_t code_length         = 255;
    const std::size_t fec_length          =   6;
+   const std::size_t part_size_bytes     = 1024 * 1024;
    const std::string input_file_name     = "input.dat";
    const std::string output_file_name    = "output.schifra";
 
    typedef schifra::reed_solomon::encoder<code_length,fec_length> encoder_t;
-   typedef schifra::reed_solomon::file_encoder<code_length,fec_length> file_encoder_t;
+   typedef schifra::reed_solomon::file_encoder<part_size_bytes,code_length,fec_length> file_encoder_t;
 
    const schifra::galois::field field(field_descriptor,
                                       schifra::galois::primitive_polynomial_size06,
@@ -61,7 +62,7 @@ int main()
 
    const encoder_t rs_encoder(field,generator_polynomial);
 
-   file_encoder_t(rs_encoder, input_file_name, output_file_name);
+   file_encoder_t file_encoder(rs_encoder, input_file_name, output_file_name);
 
    return 0;
 }
@@ -0,0 +1,503 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_FILE_PART_CODEC_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_FILE_PART_CODEC_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "schifra_reed_solomon_block.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         A part of a file in flight through one of the file pipelines,
+         holding its input, and once processed its output.
+      */
+      struct file_part
+      {
+         file_part()
+         : index(0),
+           length(0),
+           output_length(0),
+           failures(0),
+           valid(false)
+         {}
+
+         std::size_t index;
+         std::size_t length;
+         std::size_t output_length;
+         std::size_t failures;
+         bool        valid;
+         std::vector<char>          input;
+         std::vector<unsigned char> output;
+      };
+
+      /*
+         Health of one part of an encoded file as found by check_part,
+         counting its codewords, those with non-zero syndromes, the
+         symbols in error over the correctable ones and the codewords
+         that could not be corrected.
+      */
+      struct part_health
+      {
+         part_health()
+         : index(0),
+           rows(0),
+           dirty_rows(0),
+           error_count(0),
+           failures(0)
+         {}
+
+         std::size_t index;
+         std::size_t rows;
+         std::size_t dirty_rows;
+         std::size_t error_count;
+         std::size_t failures;
+      };
+
+      /*
+         Encoding and decoding of one part of the file codec format, on
+         memory supplied by the caller. The complete rows of a part are
+         laid out column-major, symbol i of every row before symbol i + 1
+         of any, which is the layout the interleaved codec works on. A
+         trailing partial row is zero padded for encoding and stored as
+         its data followed by its fec.
+      */
+
+      template <std::size_t code_length, std::size_t fec_length>
+      inline std::size_t encoded_part_size(const std::size_t length)
+      {
+         const std::size_t data_length = code_length - fec_length;
+         const std::size_t remaining   = length % data_length;
+
+         return ((length / data_length) * code_length) + ((remaining > 0) ? (remaining + fec_length) : 0);
+      }
+
+      template <std::size_t code_length, std::size_t fec_length>
+      inline std::size_t decoded_part_size(const std::size_t length)
+      {
+         const std::size_t data_length = code_length - fec_length;
+         const std::size_t remaining   = length % code_length;
+
+         return ((length / code_length) * data_length) + ((remaining > fec_length) ? (remaining - fec_length) : 0);
+      }
+
+      /*
+         Encode length bytes of row-major input into output, which must
+         hold encoded_part_size(length) bytes and may not overlap input.
+         The data is transposed straight into the output and the parity
+         columns are computed in place.
+      */
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length>
+      inline bool encode_part(const encoder<code_length,fec_length,data_length>& rs_encoder,
+                              const unsigned char* input,
+                              const std::size_t    length,
+                              unsigned char*       output)
+      {
+         typedef typename encoder<code_length,fec_length,data_length>::block_type block_type;
+
+         const std::size_t full_rows = length / data_length;
+         const std::size_t remaining = length % data_length;
+
+         if (full_rows > 0)
+         {
+            for (std::size_t j = 0; j < full_rows; ++j)
+            {
+               const unsigned char* row = input + (j * data_length);
+
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  output[(i * full_rows) + j] = row[i];
+               }
+            }
+
+            if (rs_encoder.supports_interleaved())
+            {
+               unsigned char* column[code_length];
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  column[i] = output + (i * full_rows);
+               }
+
+               if (!rs_encoder.encode_interleaved(column,full_rows))
+                  return false;
+            }
+            else
+            {
+               block_type block;
+
+               for (std::size_t j = 0; j < full_rows; ++j)
+               {
+                  for (std::size_t i = 0; i < data_length; ++i)
+                  {
+                     block.data[i] = output[(i * full_rows) + j];
+                  }
+
+                  if (!rs_encoder.encode(block))
+                     return false;
+
+                  for (std::size_t i = 0; i < fec_length; ++i)
+                  {
+                     output[((data_length + i) * full_rows) + j] = static_cast<unsigned char>(block.fec(i) & 0xFF);
+                  }
+               }
+            }
+         }
+
+         if (remaining > 0)
+         {
+            block_type block;
+
+            const unsigned char* row = input + (full_rows * data_length);
+
+            std::copy(row, row + remaining, block.data);
+            std::fill(block.data + remaining, block.data + data_length, 0x00);
+
+            if (!rs_encoder.encode(block))
+               return false;
+
+            unsigned char* tail = output + (full_rows * code_length);
+
+            std::memcpy(tail,row,remaining);
+            std::copy(block.data + data_length, block.data + code_length, tail + remaining);
+         }
+
+         return true;
+      }
+
+      /*
+         Decode length bytes of an encoded part into output, which must
+         hold decoded_part_size(length) bytes. The complete rows are
+         corrected in place within input before their data symbols are
+         transposed back into row order. Codewords that cannot be
+         corrected are output as received and added to failures. Returns
+         false only when length cannot be that of an encoded part. The
+         decoder profile of the calling thread is flushed once per part.
+      */
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length>
+      inline bool decode_part(const decoder<code_length,fec_length,data_length>& rs_decoder,
+                              unsigned char*    input,
+                              const std::size_t length,
+                              unsigned char*    output,
+                              std::size_t&      failures)
+      {
+         typedef typename decoder<code_length,fec_length,data_length>::block_type block_type;
+
+         const std::size_t full_rows = length / code_length;
+         const std::size_t remaining = length % code_length;
+
+         if ((remaining > 0) && (remaining <= fec_length))
+            return false;
+
+         if (full_rows > 0)
+         {
+            if (rs_decoder.supports_interleaved())
+            {
+               unsigned char* column[code_length];
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  column[i] = input + (i * full_rows);
+               }
+
+               std::size_t part_failures = 0;
+
+               rs_decoder.decode_interleaved(column,full_rows,part_failures);
+
+               failures += part_failures;
+            }
+            else
+            {
+               block_type block;
+
+               for (std::size_t j = 0; j < full_rows; ++j)
+               {
+                  for (std::size_t i = 0; i < code_length; ++i)
+                  {
+                     block[i] = input[(i * full_rows) + j];
+                  }
+
+                  if (!rs_decoder.decode(block))
+                  {
+                     ++failures;
+                     continue;
+                  }
+
+                  for (std::size_t i = 0; i < data_length; ++i)
+                  {
+                     input[(i * full_rows) + j] = static_cast<unsigned char>(block[i] & 0xFF);
+                  }
+               }
+            }
+
+            for (std::size_t j = 0; j < full_rows; ++j)
+            {
+               unsigned char* row = output + (j * data_length);
+
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  row[i] = input[(i * full_rows) + j];
+               }
+            }
+         }
+
+         if (remaining > 0)
+         {
+            const std::size_t    data_remaining = remaining - fec_length;
+            const unsigned char* tail           = input + (full_rows * code_length);
+            unsigned char*       row            = output + (full_rows * data_length);
+
+            block_type block;
+
+            std::copy(tail, tail + data_remaining, block.data);
+            std::fill(block.data + data_remaining, block.data + data_length, 0x00);
+            std::copy(tail + data_remaining, tail + remaining, block.data + data_length);
+
+            if (rs_decoder.decode(block))
+            {
+               std::copy(block.data, block.data + data_remaining, row);
+            }
+            else
+            {
+               std::memcpy(row,tail,data_remaining);
+               ++failures;
+            }
+         }
+
+         flush_decoder_profile();
+
+         return true;
+      }
+
+      /*
+         Copy the data symbols of an encoded part into output in row
+         order without decoding it, for parts already known to be intact.
+         Returns false when length cannot be that of an encoded part.
+      */
+      template <std::size_t code_length, std::size_t fec_length>
+      inline bool extract_part(const unsigned char* input,
+                               const std::size_t    length,
+                               unsigned char*       output)
+      {
+         const std::size_t data_length = code_length - fec_length;
+         const std::size_t full_rows   = length / code_length;
+         const std::size_t remaining   = length % code_length;
+
+         if ((remaining > 0) && (remaining <= fec_length))
+            return false;
+
+         for (std::size_t j = 0; j < full_rows; ++j)
+         {
+            unsigned char* row = output + (j * data_length);
+
+            for (std::size_t i = 0; i < data_length; ++i)
+            {
+               row[i] = input[(i * full_rows) + j];
+            }
+         }
+
+         if (remaining > 0)
+         {
+            std::memcpy(output + (full_rows * data_length), input + (full_rows * code_length), remaining - fec_length);
+         }
+
+         return true;
+      }
+
+      /*
+         Determine the health of length bytes of an encoded part without
+         altering it or producing any output, see decoder::check. Returns
+         false only when length cannot be that of an encoded part.
+      */
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length>
+      inline bool check_part(const decoder<code_length,fec_length,data_length>& rs_decoder,
+                             const unsigned char* input,
+                             const std::size_t    length,
+                             part_health&         health)
+      {
+         typedef decoder<code_length,fec_length,data_length> decoder_type;
+         typedef typename decoder_type::block_type block_type;
+
+         const std::size_t full_rows = length / code_length;
+         const std::size_t remaining = length % code_length;
+
+         if ((remaining > 0) && (remaining <= fec_length))
+            return false;
+
+         health.rows        = full_rows + ((remaining > 0) ? 1 : 0);
+         health.dirty_rows  = 0;
+         health.error_count = 0;
+         health.failures    = 0;
+
+         typename decoder_type::workspace_type workspace;
+         block_type block;
+         std::size_t error_count = 0;
+
+         if (full_rows > 0)
+         {
+            if (rs_decoder.supports_interleaved())
+            {
+               const unsigned char* column[code_length];
+
+               for (std::size_t i = 0; i < code_length; ++i)
+               {
+                  column[i] = input + (i * full_rows);
+               }
+
+               rs_decoder.check_interleaved(column,
+                                            full_rows,
+                                            health.dirty_rows,
+                                            health.error_count,
+                                            health.failures);
+            }
+            else
+            {
+               for (std::size_t j = 0; j < full_rows; ++j)
+               {
+                  for (std::size_t i = 0; i < code_length; ++i)
+                  {
+                     block[i] = input[(i * full_rows) + j];
+                  }
+
+                  if (!rs_decoder.check(block,error_count,workspace))
+                  {
+                     ++health.dirty_rows;
+                     ++health.failures;
+                  }
+                  else if (error_count > 0)
+                  {
+                     ++health.dirty_rows;
+                     health.error_count += error_count;
+                  }
+               }
+            }
+         }
+
+         if (remaining > 0)
+         {
+            const std::size_t    data_remaining = remaining - fec_length;
+            const unsigned char* tail           = input + (full_rows * code_length);
+
+            std::copy(tail, tail + data_remaining, block.data);
+            std::fill(block.data + data_remaining, block.data + data_length, 0x00);
+            std::copy(tail + data_remaining, tail + remaining, block.data + data_length);
+
+            if (!rs_decoder.check(block,error_count,workspace))
+            {
+               ++health.dirty_rows;
+               ++health.failures;
+            }
+            else if (error_count > 0)
+            {
+               ++health.dirty_rows;
+               health.error_count += error_count;
+            }
+         }
+
+         return true;
+      }
+
+      /*
+         Part processors for the file pipelines, encoding respectively
+         decoding the input of a part into its output.
+      */
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length = code_length - fec_length>
+      class file_part_encoder
+      {
+      public:
+
+         typedef encoder<code_length,fec_length,data_length> encoder_type;
+
+         explicit file_part_encoder(const encoder_type& rs_encoder)
+         : encoder_(rs_encoder)
+         {}
+
+         inline bool process_part(file_part& part) const
+         {
+            if (!encode_part(encoder_,
+                             reinterpret_cast<const unsigned char*>(&part.input[0]),
+                             part.length,
+                             &part.output[0]))
+            {
+               return false;
+            }
+
+            part.output_length = encoded_part_size<code_length,fec_length>(part.length);
+
+            return true;
+         }
+
+      private:
+
+         const encoder_type& encoder_;
+      };
+
+      template <std::size_t code_length, std::size_t fec_length, std::size_t data_length = code_length - fec_length>
+      class file_part_decoder
+      {
+      public:
+
+         typedef decoder<code_length,fec_length,data_length> decoder_type;
+
+         explicit file_part_decoder(const decoder_type& rs_decoder)
+         : decoder_(rs_decoder)
+         {}
+
+         inline bool process_part(file_part& part) const
+         {
+            if (!decode_part(decoder_,
+                             reinterpret_cast<unsigned char*>(&part.input[0]),
+                             part.length,
+                             &part.output[0],
+                             part.failures))
+            {
+               return false;
+            }
+
+            part.output_length = decoded_part_size<code_length,fec_length>(part.length);
+
+            return true;
+         }
+
+      private:
+
+         const decoder_type& decoder_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,261 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_FILE_PIPELINE_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_FILE_PIPELINE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/bind/bind.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "schifra_bounded_queue.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Reader / worker pool / writer pipeline shared by the threaded
+         file codecs. A reader thread fills parts of input_part_size
+         bytes, the worker threads hand whole parts to the processor
+         concurrently, and a writer thread emits the processed parts in
+         their original order. The stages are connected through bounded
+         queues fed from a fixed pool of part buffers, so a slow disk
+         holds back the reader rather than letting parts accumulate in
+         memory.
+
+         The processor provides bool process_part(file_part&) const,
+         which fills in the output of a part and may be called from
+         several threads at once. A part it returns false for stops the
+         pipeline, rows it could not recover but still produced output
+         for are reported through the part's failure count instead.
+      */
+      template <typename Processor>
+      class file_pipeline
+      {
+      public:
+
+         file_pipeline(const Processor&   processor,
+                       const std::string& name,
+                       const std::size_t  input_part_size,
+                       const std::size_t  output_part_size,
+                       const std::size_t  thread_count = 0)
+         : processor_(processor),
+           name_(name),
+           worker_count_(select_worker_count(thread_count)),
+           part_list_(2 * worker_count_ + 2),
+           free_queue_   (part_list_.size()),
+           process_queue_(part_list_.size()),
+           write_queue_  (part_list_.size()),
+           failure_count_(0),
+           failed_(false)
+         {
+            for (std::size_t i = 0; i < part_list_.size(); ++i)
+            {
+               part_list_[i].input .resize(input_part_size );
+               part_list_[i].output.resize(output_part_size);
+            }
+         }
+
+         inline bool run(std::ifstream& in_stream, std::ofstream& out_stream, const std::size_t file_size)
+         {
+            for (std::size_t i = 0; i < part_list_.size(); ++i)
+            {
+               free_queue_.push(&part_list_[i]);
+            }
+
+            boost::thread reader(boost::bind(&file_pipeline::read_parts ,this,boost::ref(in_stream),file_size));
+            boost::thread writer(boost::bind(&file_pipeline::write_parts,this,boost::ref(out_stream)));
+
+            boost::thread_group workers;
+
+            for (std::size_t i = 0; i < worker_count_; ++i)
+            {
+               workers.create_thread(boost::bind(&file_pipeline::process_parts,this));
+            }
+
+            reader.join();
+            workers.join_all();
+
+            write_queue_.close();
+            writer.join();
+
+            return !failed_;
+         }
+
+         /* Total of the failures reported by the processor across all parts. */
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+      private:
+
+         file_pipeline(const file_pipeline&);
+         file_pipeline& operator=(const file_pipeline&);
+
+         static inline std::size_t select_worker_count(const std::size_t thread_count)
+         {
+            if (thread_count > 0)
+               return thread_count;
+
+            const std::size_t hardware_threads = boost::thread::hardware_concurrency();
+
+            return (hardware_threads > 0) ? hardware_threads : 1;
+         }
+
+         inline void fail(const std::string& message)
+         {
+            boost::mutex::scoped_lock lock(failure_mutex_);
+
+            if (!failed_)
+            {
+               std::cout << name_ << " - Error: " << message << std::endl;
+               failed_ = true;
+            }
+         }
+
+         inline bool failed()
+         {
+            boost::mutex::scoped_lock lock(failure_mutex_);
+            return failed_;
+         }
+
+         void read_parts(std::ifstream& in_stream, const std::size_t file_size)
+         {
+            std::size_t offset = 0;
+            std::size_t index  = 0;
+
+            file_part* part = 0;
+
+            while ((offset < file_size) && !failed() && free_queue_.pop(part))
+            {
+               part->index         = index++;
+               part->length        = std::min<std::size_t>(part->input.size(), file_size - offset);
+               part->output_length = 0;
+               part->failures      = 0;
+               part->valid         = false;
+
+               in_stream.read(&part->input[0],static_cast<std::streamsize>(part->length));
+
+               if (static_cast<std::size_t>(in_stream.gcount()) != part->length)
+               {
+                  fail("input file could not be read.");
+                  break;
+               }
+
+               offset += part->length;
+
+               process_queue_.push(part);
+            }
+
+            process_queue_.close();
+         }
+
+         void process_parts()
+         {
+            file_part* part = 0;
+
+            while (process_queue_.pop(part))
+            {
+               part->valid = !failed() && processor_.process_part(*part);
+
+               if (!part->valid)
+               {
+                  fail("processing of part failed.");
+               }
+
+               write_queue_.push(part);
+            }
+         }
+
+         void write_parts(std::ofstream& out_stream)
+         {
+            /*
+               Workers complete parts out of order, those that arrive
+               ahead of their turn are held until the gap before them
+               has been written.
+            */
+            std::map<std::size_t,file_part*> pending;
+            std::size_t next_index = 0;
+
+            file_part* part = 0;
+
+            while (write_queue_.pop(part))
+            {
+               pending[part->index] = part;
+
+               while (!pending.empty() && (pending.begin()->first == next_index))
+               {
+                  file_part* ready = pending.begin()->second;
+                  pending.erase(pending.begin());
+
+                  if (ready->valid && !failed())
+                  {
+                     failure_count_ += ready->failures;
+
+                     out_stream.write(reinterpret_cast<const char*>(&ready->output[0]),
+                                      static_cast<std::streamsize>(ready->output_length));
+
+                     if (!out_stream)
+                     {
+                        fail("output file could not be written.");
+                     }
+                  }
+
+                  free_queue_.push(ready);
+                  ++next_index;
+               }
+            }
+         }
+
+         const Processor& processor_;
+         const std::string name_;
+         const std::size_t worker_count_;
+         std::vector<file_part> part_list_;
+         utils::bounded_queue<file_part*> free_queue_;
+         utils::bounded_queue<file_part*> process_queue_;
+         utils::bounded_queue<file_part*> write_queue_;
+         std::size_t failure_count_;
+         boost::mutex failure_mutex_;
+         bool failed_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,172 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_FILE_SCRUBBER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_FILE_SCRUBBER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Read-only verification of a file written by any of the file
+         encoders. Each part is read in one go and checked in place, see
+         check_part: syndromes are computed for every codeword and only
+         those of codewords with non-zero syndromes are taken on to error
+         location. Nothing is corrected or written, the result being the
+         health of every part of the file.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class file_scrubber
+      {
+      public:
+
+         typedef decoder<code_length,fec_length> decoder_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * code_length       };
+
+         file_scrubber(const decoder_type& decoder, const std::string& input_file_name)
+         : success_(false),
+           dirty_row_count_(0),
+           error_count_(0),
+           failure_count_(0)
+         {
+            const std::size_t file_size = schifra::fileio::file_size(input_file_name);
+
+            if (0 == file_size)
+            {
+               std::cout << "reed_solomon::file_scrubber() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            std::ifstream in_stream(input_file_name.c_str(),std::ios::binary);
+
+            if (!in_stream)
+            {
+               std::cout << "reed_solomon::file_scrubber() - Error: input file could not be opened." << std::endl;
+               return;
+            }
+
+            std::vector<unsigned char> buffer(part_input_size);
+
+            for (std::size_t offset = 0; offset < file_size; offset += part_input_size)
+            {
+               const std::size_t length = std::min<std::size_t>(part_input_size, file_size - offset);
+
+               in_stream.read(reinterpret_cast<char*>(&buffer[0]),static_cast<std::streamsize>(length));
+
+               if (static_cast<std::size_t>(in_stream.gcount()) != length)
+               {
+                  std::cout << "reed_solomon::file_scrubber() - Error: input file could not be read." << std::endl;
+                  return;
+               }
+
+               part_health health;
+
+               health.index = part_health_list_.size();
+
+               if (!check_part(decoder,&buffer[0],length,health))
+               {
+                  std::cout << "reed_solomon::file_scrubber() - Error: invalid encoded part length." << std::endl;
+                  return;
+               }
+
+               dirty_row_count_ += health.dirty_rows;
+               error_count_     += health.error_count;
+               failure_count_   += health.failures;
+
+               part_health_list_.push_back(health);
+            }
+
+            in_stream.close();
+
+            success_ = true;
+         }
+
+         /* True when the whole file was read and checked. */
+         inline bool success() const
+         {
+            return success_;
+         }
+
+         /* True when every codeword of the file is clean or correctable. */
+         inline bool healthy() const
+         {
+            return success_ && (0 == failure_count_);
+         }
+
+         inline std::size_t dirty_row_count() const
+         {
+            return dirty_row_count_;
+         }
+
+         inline std::size_t error_count() const
+         {
+            return error_count_;
+         }
+
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+         inline const std::vector<part_health>& part_health_list() const
+         {
+            return part_health_list_;
+         }
+
+      private:
+
+         file_scrubber(const file_scrubber&);
+         file_scrubber& operator=(const file_scrubber&);
+
+         bool success_;
+         std::size_t dirty_row_count_;
+         std::size_t error_count_;
+         std::size_t failure_count_;
+         std::vector<part_health> part_health_list_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,127 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+/*
+   Description: This example will demonstrate how to verify the health of
+                an encoded file without decoding it. A few bytes of the
+                encoded file are damaged, after which the scrubber reports
+                for each part how many codewords are in error and whether
+                they are still correctable.
+*/
+
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "schifra_galois_field.hpp"
+#include "schifra_sequential_root_generator_polynomial_creator.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_encoder.hpp"
+#include "schifra_reed_solomon_file_scrubber.hpp"
+
+
+int main()
+{
+   const std::size_t field_descriptor    =       8;
+   const std::size_t gen_poly_index      =     120;
+   const std::size_t gen_poly_root_count =      32;
+   const std::size_t code_length         =     255;
+   const std::size_t fec_length          =      32;
+   const std::size_t part_size_bytes     = 1048576;
+   const std::string input_file_name     = "input.dat";
+   const std::string output_file_name    = "output.schifra";
+
+   typedef schifra::reed_solomon::encoder<code_length,fec_length> encoder_t;
+   typedef schifra::reed_solomon::decoder<code_length,fec_length> decoder_t;
+   typedef schifra::reed_solomon::file_encoder<part_size_bytes,code_length,fec_length> file_encoder_t;
+   typedef schifra::reed_solomon::file_scrubber<part_size_bytes,code_length,fec_length> file_scrubber_t;
+
+   const schifra::galois::field field(field_descriptor,
+                                      schifra::galois::primitive_polynomial_size06,
+                                      schifra::galois::primitive_polynomial06);
+
+   schifra::galois::field_polynomial generator_polynomial(field);
+
+   if (
+        !schifra::make_sequential_root_generator_polynomial(field,
+                                                            gen_poly_index,
+                                                            gen_poly_root_count,
+                                                            generator_polynomial)
+      )
+   {
+      std::cout << "Error - Failed to create sequential root generator!" << std::endl;
+      return 1;
+   }
+
+   const encoder_t rs_encoder(field,generator_polynomial);
+   const decoder_t rs_decoder(field,gen_poly_index);
+
+   std::string data(3000000,'A');
+
+   for (std::size_t i = 0; i < data.size(); ++i)
+   {
+      data[i] = static_cast<char>((i * 7) & 0xFF);
+   }
+
+   schifra::fileio::write_file(input_file_name,data);
+
+   const file_encoder_t file_encoder(rs_encoder, input_file_name, output_file_name);
+
+   /* Damage a short run of bytes in the first part and a single byte in the last. */
+   std::string encoded;
+
+   schifra::fileio::load_file(output_file_name,encoded);
+
+   for (std::size_t i = 1000; i < 1100; ++i)
+   {
+      encoded[i] = static_cast<char>(~encoded[i]);
+   }
+
+   encoded[encoded.size() - 5] = static_cast<char>(~encoded[encoded.size() - 5]);
+
+   schifra::fileio::write_file(output_file_name,encoded);
+
+   const file_scrubber_t scrubber(rs_decoder, output_file_name);
+
+   if (!scrubber.success())
+   {
+      std::cout << "Error - File scrub failed!" << std::endl;
+      return 1;
+   }
+
+   for (std::size_t i = 0; i < scrubber.part_health_list().size(); ++i)
+   {
+      const schifra::reed_solomon::part_health& health = scrubber.part_health_list()[i];
+
+      std::cout << "Part: "          << health.index
+                << "  Codewords: "   << health.rows
+                << "  Dirty: "       << health.dirty_rows
+                << "  Errors: "      << health.error_count
+                << "  Failures: "    << health.failures << std::endl;
+   }
+
+   std::cout << "File is " << (scrubber.healthy() ? "healthy" : "NOT recoverable") << std::endl;
+
+   return 0;
+}
@@ -0,0 +1,379 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_FILE_UPDATE_ENCODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_FILE_UPDATE_ENCODER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "schifra_reed_solomon_block.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Update mode of the file encoders. Applies a change of length
+         bytes at offset of the original file to an existing encoded file
+         in place, without re-reading or re-encoding the rest of it.
+
+         The code is linear, so the parity of a codeword with data d' is
+         that of d plus that of d + d'. Only the rows the change touches
+         are encoded, with the difference of the old and new data as
+         their data, and the result is added onto their stored parity.
+         The changed data bytes and those parity symbols are the only
+         parts of the encoded file that are read or written.
+
+         The old data must be what the encoded file currently holds in
+         that range, which is checked before anything is written. The
+         size of the original file cannot change, it is taken from the
+         size of the encoded file.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class file_update_encoder
+      {
+      public:
+
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef typename encoder_type::block_type block_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * data_length       };
+         enum { part_output_size = part_rows * code_length       };
+
+         file_update_encoder(const encoder_type& encoder,
+                             const std::string& encoded_file_name,
+                             const std::size_t offset,
+                             const char* old_data,
+                             const char* new_data,
+                             const std::size_t length)
+         : success_(false),
+           updated_row_count_(0),
+           encoder_(encoder),
+           offset_(offset),
+           old_data_(reinterpret_cast<const unsigned char*>(old_data)),
+           new_data_(reinterpret_cast<const unsigned char*>(new_data)),
+           length_(length),
+           data_size_(0)
+         {
+            const std::size_t encoded_size = schifra::fileio::file_size(encoded_file_name);
+
+            if (0 == encoded_size)
+            {
+               std::cout << "reed_solomon::file_update_encoder() - Error: encoded file has ZERO size." << std::endl;
+               return;
+            }
+
+            const std::size_t tail_size = encoded_size % part_output_size;
+
+            if (((tail_size % code_length) > 0) && ((tail_size % code_length) <= fec_length))
+            {
+               std::cout << "reed_solomon::file_update_encoder() - Error: invalid encoded file size." << std::endl;
+               return;
+            }
+
+            data_size_ = ((encoded_size / part_output_size) * part_input_size) +
+                         decoded_part_size<code_length,fec_length>(tail_size);
+
+            if ((offset_ > data_size_) || (length_ > (data_size_ - offset_)))
+            {
+               std::cout << "reed_solomon::file_update_encoder() - Error: update range exceeds file." << std::endl;
+               return;
+            }
+
+            if (0 == length_)
+            {
+               success_ = true;
+               return;
+            }
+
+            stream_.open(encoded_file_name.c_str(),std::ios::in | std::ios::out | std::ios::binary);
+
+            if (!stream_)
+            {
+               std::cout << "reed_solomon::file_update_encoder() - Error: encoded file could not be opened." << std::endl;
+               return;
+            }
+
+            /*
+               The whole range is verified before the first write, so a
+               mismatch leaves the encoded file untouched.
+            */
+            const std::size_t first_part = offset_ / part_input_size;
+            const std::size_t last_part  = (offset_ + length_ - 1) / part_input_size;
+
+            for (std::size_t part = first_part; part <= last_part; ++part)
+            {
+               if (!process_part(part,false))
+               {
+                  std::cout << "reed_solomon::file_update_encoder() - Error: old data does not match encoded file." << std::endl;
+                  return;
+               }
+            }
+
+            for (std::size_t part = first_part; part <= last_part; ++part)
+            {
+               if (!process_part(part,true))
+               {
+                  std::cout << "reed_solomon::file_update_encoder() - Error: encoded file could not be updated." << std::endl;
+                  return;
+               }
+            }
+
+            stream_.close();
+
+            success_ = !stream_.fail();
+         }
+
+         inline bool success() const
+         {
+            return success_;
+         }
+
+         /* Number of codewords whose parity was changed. */
+         inline std::size_t updated_row_count() const
+         {
+            return updated_row_count_;
+         }
+
+      private:
+
+         file_update_encoder(const file_update_encoder&);
+         file_update_encoder& operator=(const file_update_encoder&);
+
+         /*
+            Verify (update == false) or rewrite (update == true) the
+            portion of the change that falls into the given part. Within
+            the complete rows of a part, the bytes of one column over a
+            run of consecutive rows are contiguous in the encoded file,
+            so each data and parity column is accessed with a single
+            read or write. The trailing partial row is stored row-major.
+         */
+         inline bool process_part(const std::size_t part, const bool update)
+         {
+            const std::size_t part_start  = part * part_input_size;
+            const std::size_t part_base   = part * part_output_size;
+            const std::size_t part_length = std::min<std::size_t>(part_input_size, data_size_ - part_start);
+            const std::size_t full_rows   = part_length / data_length;
+            const std::size_t remaining   = part_length % data_length;
+            const std::size_t full_length = full_rows * data_length;
+
+            const std::size_t begin = std::max(offset_, part_start) - part_start;
+            const std::size_t end   = std::min(offset_ + length_, part_start + part_length) - part_start;
+
+            const std::size_t full_end = std::min(end, full_length);
+
+            if (begin < full_end)
+            {
+               const std::size_t first_row = begin / data_length;
+               const std::size_t last_row  = (full_end - 1) / data_length;
+               const std::size_t row_count = last_row - first_row + 1;
+
+               buffer_.resize(row_count);
+
+               for (std::size_t i = 0; i < data_length; ++i)
+               {
+                  const std::size_t low_row  = ((first_row * data_length) + i >= begin   ) ? first_row : first_row + 1;
+                  const std::size_t high_row = ((last_row  * data_length) + i <  full_end) ? last_row + 1 : last_row;
+
+                  if (low_row >= high_row)
+                     continue;
+
+                  const std::size_t count    = high_row - low_row;
+                  const std::size_t position = part_base + (i * full_rows) + low_row;
+                  const std::size_t source   = part_start + (low_row * data_length) + i - offset_;
+
+                  if (!update)
+                  {
+                     if (!read(position,count))
+                        return false;
+
+                     for (std::size_t j = 0; j < count; ++j)
+                     {
+                        if (buffer_[j] != old_data_[source + (j * data_length)])
+                           return false;
+                     }
+                  }
+                  else
+                  {
+                     for (std::size_t j = 0; j < count; ++j)
+                     {
+                        buffer_[j] = new_data_[source + (j * data_length)];
+                     }
+
+                     if (!write(position,count))
+                        return false;
+                  }
+               }
+
+               if (update)
+               {
+                  delta_.assign(row_count * fec_length, 0x00);
+
+                  for (std::size_t j = 0; j < row_count; ++j)
+                  {
+                     const std::size_t row_start = (first_row + j) * data_length;
+                     const std::size_t low       = std::max(begin, row_start) - row_start;
+                     const std::size_t high      = std::min(full_end, row_start + data_length) - row_start;
+
+                     if (encode_delta(part_start + row_start - offset_, low, high))
+                     {
+                        std::copy(block_.data + data_length, block_.data + code_length, &delta_[j * fec_length]);
+                     }
+                  }
+
+                  for (std::size_t k = 0; k < fec_length; ++k)
+                  {
+                     const std::size_t position = part_base + ((data_length + k) * full_rows) + first_row;
+
+                     if (!read(position,row_count))
+                        return false;
+
+                     for (std::size_t j = 0; j < row_count; ++j)
+                     {
+                        buffer_[j] ^= delta_[(j * fec_length) + k];
+                     }
+
+                     if (!write(position,row_count))
+                        return false;
+                  }
+               }
+            }
+
+            if ((remaining > 0) && (end > full_length))
+            {
+               const std::size_t tail_base = part_base + (full_rows * code_length);
+               const std::size_t low       = std::max(begin, full_length) - full_length;
+               const std::size_t high      = end - full_length;
+               const std::size_t source    = part_start + full_length - offset_;
+
+               buffer_.resize(std::max(high - low, fec_length));
+
+               if (!update)
+               {
+                  if (!read(tail_base + low, high - low))
+                     return false;
+
+                  return std::equal(buffer_.begin(), buffer_.begin() + (high - low), old_data_ + source + low);
+               }
+
+               std::copy(new_data_ + source + low, new_data_ + source + high, buffer_.begin());
+
+               if (!write(tail_base + low, high - low))
+                  return false;
+
+               if (encode_delta(source, low, high))
+               {
+                  if (!read(tail_base + remaining, fec_length))
+                     return false;
+
+                  for (std::size_t k = 0; k < fec_length; ++k)
+                  {
+                     buffer_[k] ^= static_cast<unsigned char>(block_.fec(k));
+                  }
+
+                  if (!write(tail_base + remaining, fec_length))
+                     return false;
+               }
+            }
+
+            return true;
+         }
+
+         /*
+            Encode the difference of the old and new data over columns
+            [low,high) of the row starting at source of the change, zero
+            elsewhere. Returns false, leaving the parity unencoded, when
+            the data did not actually change.
+         */
+         inline bool encode_delta(const std::size_t source, const std::size_t low, const std::size_t high)
+         {
+            bool changed = false;
+
+            std::fill(block_.data, block_.data + data_length, 0x00);
+
+            for (std::size_t i = low; i < high; ++i)
+            {
+               block_.data[i] = static_cast<typename block_type::symbol_type>(old_data_[source + i] ^ new_data_[source + i]);
+               changed = changed || (0 != block_.data[i]);
+            }
+
+            if (!changed)
+               return false;
+
+            encoder_.encode(block_);
+
+            ++updated_row_count_;
+
+            return true;
+         }
+
+         inline bool read(const std::size_t position, const std::size_t count)
+         {
+            stream_.seekg(static_cast<std::streamoff>(position));
+            stream_.read(reinterpret_cast<char*>(&buffer_[0]),static_cast<std::streamsize>(count));
+
+            return static_cast<std::size_t>(stream_.gcount()) == count;
+         }
+
+         inline bool write(const std::size_t position, const std::size_t count)
+         {
+            stream_.seekp(static_cast<std::streamoff>(position));
+            stream_.write(reinterpret_cast<const char*>(&buffer_[0]),static_cast<std::streamsize>(count));
+
+            return !stream_.fail();
+         }
+
+         bool success_;
+         std::size_t updated_row_count_;
+         const encoder_type& encoder_;
+         const std::size_t offset_;
+         const unsigned char* old_data_;
+         const unsigned char* new_data_;
+         const std::size_t length_;
+         std::size_t data_size_;
+         std::fstream stream_;
+         block_type block_;
+         std::vector<unsigned char> buffer_;
+         std::vector<unsigned char> delta_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,107 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+/*
+   Description: This example will demonstrate how to bring an encoded file
+                up to date after a small change to the original, rewriting
+                only the changed data bytes and the parity of the affected
+                codewords rather than encoding the whole file again.
+*/
+
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "schifra_galois_field.hpp"
+#include "schifra_sequential_root_generator_polynomial_creator.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_file_encoder.hpp"
+#include "schifra_reed_solomon_file_update_encoder.hpp"
+
+
+int main()
+{
+   const std::size_t field_descriptor    =       8;
+   const std::size_t gen_poly_index      =     120;
+   const std::size_t gen_poly_root_count =      32;
+   const std::size_t code_length         =     255;
+   const std::size_t fec_length          =      32;
+   const std::size_t part_size_bytes     = 1048576;
+   const std::string input_file_name     = "input.dat";
+   const std::string output_file_name    = "output.schifra";
+
+   typedef schifra::reed_solomon::encoder<code_length,fec_length> encoder_t;
+   typedef schifra::reed_solomon::file_encoder<part_size_bytes,code_length,fec_length> file_encoder_t;
+   typedef schifra::reed_solomon::file_update_encoder<part_size_bytes,code_length,fec_length> file_update_encoder_t;
+
+   const schifra::galois::field field(field_descriptor,
+                                      schifra::galois::primitive_polynomial_size06,
+                                      schifra::galois::primitive_polynomial06);
+
+   schifra::galois::field_polynomial generator_polynomial(field);
+
+   if (
+        !schifra::make_sequential_root_generator_polynomial(field,
+                                                            gen_poly_index,
+                                                            gen_poly_root_count,
+                                                            generator_polynomial)
+      )
+   {
+      std::cout << "Error - Failed to create sequential root generator!" << std::endl;
+      return 1;
+   }
+
+   const encoder_t rs_encoder(field,generator_polynomial);
+
+   std::string data(100000,'A');
+
+   schifra::fileio::write_file(input_file_name,data);
+
+   const file_encoder_t file_encoder(rs_encoder, input_file_name, output_file_name);
+
+   /* Change a few bytes of the original and apply the change to the encoded file. */
+   const std::size_t offset = 31337;
+   const std::string old_data = data.substr(offset,12);
+   const std::string new_data = "Schifra 2020";
+
+   data.replace(offset,new_data.size(),new_data);
+
+   schifra::fileio::write_file(input_file_name,data);
+
+   const file_update_encoder_t update_encoder(rs_encoder,
+                                              output_file_name,
+                                              offset,
+                                              old_data.data(),
+                                              new_data.data(),
+                                              new_data.size());
+
+   if (!update_encoder.success())
+   {
+      std::cout << "Error - File update failed!" << std::endl;
+      return 1;
+   }
+
+   std::cout << "Updated codewords: " << update_encoder.updated_row_count() << std::endl;
+
+   return 0;
+}
@@ -0,0 +1,98 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+/*
+   Description: This example will demonstrate how to instantiate the
+                memory mapped Reed-Solomon file encoder and decoder. The
+                input file is encoded directly from its mapping into the
+                mapping of the encoded file, which is then decoded back
+                into a copy of the original.
+*/
+
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "schifra_galois_field.hpp"
+#include "schifra_sequential_root_generator_polynomial_creator.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_mapped_file_encoder.hpp"
+#include "schifra_reed_solomon_mapped_file_decoder.hpp"
+
+
+int main()
+{
+   const std::size_t field_descriptor    =       8;
+   const std::size_t gen_poly_index      =     120;
+   const std::size_t gen_poly_root_count =      32;
+   const std::size_t code_length         =     255;
+   const std::size_t fec_length          =      32;
+   const std::size_t part_size_bytes     = 1048576;
+   const std::string input_file_name     = "input.dat";
+   const std::string encoded_file_name   = "output.schifra";
+   const std::string decoded_file_name   = "output.decoded";
+
+   typedef schifra::reed_solomon::encoder<code_length,fec_length> encoder_t;
+   typedef schifra::reed_solomon::decoder<code_length,fec_length> decoder_t;
+   typedef schifra::reed_solomon::mapped_file_encoder<part_size_bytes,code_length,fec_length> file_encoder_t;
+   typedef schifra::reed_solomon::mapped_file_decoder<part_size_bytes,code_length,fec_length> file_decoder_t;
+
+   const schifra::galois::field field(field_descriptor,
+                                      schifra::galois::primitive_polynomial_size06,
+                                      schifra::galois::primitive_polynomial06);
+
+   schifra::galois::field_polynomial generator_polynomial(field);
+
+   if (
+        !schifra::make_sequential_root_generator_polynomial(field,
+                                                            gen_poly_index,
+                                                            gen_poly_root_count,
+                                                            generator_polynomial)
+      )
+   {
+      std::cout << "Error - Failed to create sequential root generator!" << std::endl;
+      return 1;
+   }
+
+   const encoder_t rs_encoder(field,generator_polynomial);
+   const decoder_t rs_decoder(field,gen_poly_index);
+
+   const file_encoder_t file_encoder(rs_encoder, input_file_name, encoded_file_name);
+
+   if (!file_encoder.success())
+   {
+      std::cout << "Error - File encoding failed!" << std::endl;
+      return 1;
+   }
+
+   const file_decoder_t file_decoder(rs_decoder, encoded_file_name, decoded_file_name);
+
+   if (!file_decoder.success())
+   {
+      std::cout << "Error - File decoding failed!" << std::endl;
+      return 1;
+   }
+
+   return 0;
+}
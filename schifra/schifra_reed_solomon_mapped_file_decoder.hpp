@@ -0,0 +1,161 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_MAPPED_FILE_DECODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_MAPPED_FILE_DECODER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_mapped_file.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Memory mapped counterpart of file_decoder. The input is mapped
+         privately, so codewords are corrected in place within the
+         mapping - only the pages holding corrections are ever copied -
+         and the data is transposed straight into the output mapping.
+         Codewords that cannot be corrected are written out as received
+         and counted.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class mapped_file_decoder
+      {
+      public:
+
+         typedef decoder<code_length,fec_length> decoder_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * code_length       };
+         enum { part_output_size = part_rows * data_length       };
+
+         mapped_file_decoder(const decoder_type& decoder,
+                             const std::string& input_file_name,
+                             const std::string& output_file_name)
+         : success_(false),
+           failure_count_(0)
+         {
+            if (0 == schifra::fileio::file_size(input_file_name))
+            {
+               std::cout << "reed_solomon::mapped_file_decoder() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            fileio::mapped_file input;
+
+            if (!input.open_input(input_file_name))
+            {
+               std::cout << "reed_solomon::mapped_file_decoder() - Error: input file could not be mapped." << std::endl;
+               return;
+            }
+
+            const std::size_t file_size = input.size();
+            const std::size_t tail_size = file_size % part_input_size;
+
+            if (((tail_size % code_length) > 0) && ((tail_size % code_length) <= fec_length))
+            {
+               std::cout << "reed_solomon::mapped_file_decoder() - Error: input file is truncated." << std::endl;
+               return;
+            }
+
+            fileio::mapped_file output;
+
+            if (!output.create_output(output_file_name,decoded_file_size(file_size)))
+            {
+               std::cout << "reed_solomon::mapped_file_decoder() - Error: output file could not be created." << std::endl;
+               return;
+            }
+
+            unsigned char* input_data  = input .data();
+            unsigned char* output_data = output.data();
+
+            for (std::size_t offset = 0; offset < file_size; offset += part_input_size)
+            {
+               const std::size_t length = std::min<std::size_t>(part_input_size, file_size - offset);
+
+               decode_part(decoder,input_data,length,output_data,failure_count_);
+
+               input_data  += length;
+               output_data += decoded_part_size<code_length,fec_length>(length);
+            }
+
+            if (failure_count_ > 0)
+            {
+               std::cout << "reed_solomon::mapped_file_decoder() - Error: "
+                         << failure_count_ << " codeword(s) could not be corrected." << std::endl;
+            }
+
+            if (!output.close())
+            {
+               std::cout << "reed_solomon::mapped_file_decoder() - Error: output file could not be written." << std::endl;
+               return;
+            }
+
+            success_ = true;
+         }
+
+         /* True when the whole file was decoded and fully corrected. */
+         inline bool success() const
+         {
+            return success_ && (0 == failure_count_);
+         }
+
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+         static inline std::size_t decoded_file_size(const std::size_t file_size)
+         {
+            return ((file_size / part_input_size) * part_output_size) +
+                   decoded_part_size<code_length,fec_length>(file_size % part_input_size);
+         }
+
+      private:
+
+         mapped_file_decoder(const mapped_file_decoder&);
+         mapped_file_decoder& operator=(const mapped_file_decoder&);
+
+         bool success_;
+         std::size_t failure_count_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,143 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_MAPPED_FILE_ENCODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_MAPPED_FILE_ENCODER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_mapped_file.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Memory mapped counterpart of file_encoder, producing byte for
+         byte the same output. The output file is created at its final
+         size up front, and each part is encoded straight from the input
+         mapping into the output mapping, with no stream buffers or part
+         copies in between.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class mapped_file_encoder
+      {
+      public:
+
+         typedef encoder<code_length,fec_length> encoder_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * data_length       };
+         enum { part_output_size = part_rows * code_length       };
+
+         mapped_file_encoder(const encoder_type& encoder,
+                             const std::string& input_file_name,
+                             const std::string& output_file_name)
+         : success_(false)
+         {
+            if (0 == schifra::fileio::file_size(input_file_name))
+            {
+               std::cout << "reed_solomon::mapped_file_encoder() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            fileio::mapped_file input;
+
+            if (!input.open_input(input_file_name))
+            {
+               std::cout << "reed_solomon::mapped_file_encoder() - Error: input file could not be mapped." << std::endl;
+               return;
+            }
+
+            const std::size_t file_size = input.size();
+
+            fileio::mapped_file output;
+
+            if (!output.create_output(output_file_name,encoded_file_size(file_size)))
+            {
+               std::cout << "reed_solomon::mapped_file_encoder() - Error: output file could not be created." << std::endl;
+               return;
+            }
+
+            const unsigned char* input_data  = input .data();
+            unsigned char*       output_data = output.data();
+
+            for (std::size_t offset = 0; offset < file_size; offset += part_input_size)
+            {
+               const std::size_t length = std::min<std::size_t>(part_input_size, file_size - offset);
+
+               if (!encode_part(encoder,input_data,length,output_data))
+               {
+                  std::cout << "reed_solomon::mapped_file_encoder() - Error: encoding of part failed." << std::endl;
+                  return;
+               }
+
+               input_data  += length;
+               output_data += encoded_part_size<code_length,fec_length>(length);
+            }
+
+            if (!output.close())
+            {
+               std::cout << "reed_solomon::mapped_file_encoder() - Error: output file could not be written." << std::endl;
+               return;
+            }
+
+            success_ = true;
+         }
+
+         inline bool success() const
+         {
+            return success_;
+         }
+
+         static inline std::size_t encoded_file_size(const std::size_t file_size)
+         {
+            return ((file_size / part_input_size) * part_output_size) +
+                   encoded_part_size<code_length,fec_length>(file_size % part_input_size);
+         }
+
+      private:
+
+         mapped_file_encoder(const mapped_file_encoder&);
+         mapped_file_encoder& operator=(const mapped_file_encoder&);
+
+         bool success_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
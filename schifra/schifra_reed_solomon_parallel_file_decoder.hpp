@@ -0,0 +1,145 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_PARALLEL_FILE_DECODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_PARALLEL_FILE_DECODER_HPP
+
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "schifra_reed_solomon_block.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_reed_solomon_file_pipeline.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Pipelined counterpart of file_decoder, restoring files written
+         by either file_encoder or parallel_file_encoder. Each part is
+         read in one go and decoded in memory by a pool of worker threads,
+         see file_pipeline. Codewords that cannot be corrected are written
+         out as received and counted, rather than stopping the restore.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class parallel_file_decoder
+      {
+      public:
+
+         typedef decoder<code_length,fec_length> decoder_type;
+         typedef typename decoder_type::block_type block_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * code_length       };
+         enum { part_output_size = part_rows * data_length       };
+
+         parallel_file_decoder(const decoder_type& decoder,
+                               const std::string& input_file_name,
+                               const std::string& output_file_name,
+                               const std::size_t thread_count = 0)
+         : success_(false),
+           failure_count_(0)
+         {
+            const std::size_t file_size = schifra::fileio::file_size(input_file_name);
+
+            if (0 == file_size)
+            {
+               std::cout << "reed_solomon::parallel_file_decoder() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            std::ifstream in_stream(input_file_name.c_str(),std::ios::binary);
+
+            if (!in_stream)
+            {
+               std::cout << "reed_solomon::parallel_file_decoder() - Error: input file could not be opened." << std::endl;
+               return;
+            }
+
+            std::ofstream out_stream(output_file_name.c_str(),std::ios::binary);
+
+            if (!out_stream)
+            {
+               std::cout << "reed_solomon::parallel_file_decoder() - Error: output file could not be created." << std::endl;
+               return;
+            }
+
+            typedef file_part_decoder<code_length,fec_length> processor_type;
+
+            const processor_type processor(decoder);
+
+            file_pipeline<processor_type> pipeline(processor,
+                                                   "reed_solomon::parallel_file_decoder()",
+                                                   part_input_size,
+                                                   part_output_size,
+                                                   thread_count);
+
+            success_       = pipeline.run(in_stream,out_stream,file_size);
+            failure_count_ = pipeline.failure_count();
+
+            if (failure_count_ > 0)
+            {
+               std::cout << "reed_solomon::parallel_file_decoder() - Error: "
+                         << failure_count_ << " codeword(s) could not be corrected." << std::endl;
+            }
+
+            in_stream.close();
+            out_stream.close();
+         }
+
+         /* True when the whole file was read, decoded and fully corrected. */
+         inline bool success() const
+         {
+            return success_ && (0 == failure_count_);
+         }
+
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+      private:
+
+         parallel_file_decoder(const parallel_file_decoder&);
+         parallel_file_decoder& operator=(const parallel_file_decoder&);
+
+         bool success_;
+         std::size_t failure_count_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,211 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_SHARD_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_SHARD_HPP
+
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "schifra_crc.hpp"
+#include "schifra_reed_solomon_container.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Shard layout for striping a file over k data and m parity shard
+         files, typically each on a separate device. The file is cut into
+         stripes of k chunks, chunk i of a stripe going to data shard i.
+         Byte r of every chunk of a stripe forms the data of one codeword
+         of a shortened code, whose parity bytes become byte r of the m
+         parity chunks. Any k intact shards then suffice to restore the
+         stripe. The final stripe has fewer rows, the chunks of every
+         shard are shortened alike and the data past the end of the file
+         is taken as zeros.
+
+            shard file
+               header (64 bytes, little-endian)
+                  0  magic "SCHIFRA\x53"
+                  8  format version (u16), header size (u16)
+                 12  shard index, data shard count,
+                     parity shard count, code length (u32 each)
+                 28  chunk size (u32)
+                 32  original file size (u64)
+                 56  header checksum (u32), reserved (u32)
+
+               per stripe: chunk (rows bytes), CRC-32C of the chunk (u32)
+
+         A chunk failing its checksum is treated as an erasure for its
+         stripe only, so damage on one device costs only what it touches.
+      */
+      struct shard_header
+      {
+         enum { size      = 64 };
+         enum { version_1 =  1 };
+
+         shard_header()
+         : version(version_1),
+           shard_index(0),
+           data_shard_count(0),
+           parity_shard_count(0),
+           code_length(0),
+           chunk_size(0),
+           file_size(0)
+         {}
+
+         inline std::size_t shard_count() const
+         {
+            return data_shard_count + parity_shard_count;
+         }
+
+         inline std::size_t stripe_size() const
+         {
+            return data_shard_count * chunk_size;
+         }
+
+         inline std::size_t stripe_count() const
+         {
+            return (file_size + stripe_size() - 1) / stripe_size();
+         }
+
+         /* Rows, being the chunk length, of the given stripe. */
+         inline std::size_t stripe_rows(const std::size_t stripe) const
+         {
+            const std::size_t remaining = file_size - (stripe * stripe_size());
+
+            if (remaining >= stripe_size())
+               return chunk_size;
+            else
+               return (remaining + data_shard_count - 1) / data_shard_count;
+         }
+
+         /* True when the two headers describe shards of the same set. */
+         inline bool same_set(const shard_header& header) const
+         {
+            return (version            == header.version           ) &&
+                   (data_shard_count   == header.data_shard_count  ) &&
+                   (parity_shard_count == header.parity_shard_count) &&
+                   (code_length        == header.code_length       ) &&
+                   (chunk_size         == header.chunk_size        ) &&
+                   (file_size          == header.file_size         ) ;
+         }
+
+         inline void write(unsigned char buffer[size]) const
+         {
+            std::memset(buffer, 0x00, size);
+            std::memcpy(buffer, "SCHIFRA\x53", 8);
+
+            details::store_le(buffer +  8, version            , 2);
+            details::store_le(buffer + 10, size               , 2);
+            details::store_le(buffer + 12, shard_index        , 4);
+            details::store_le(buffer + 16, data_shard_count   , 4);
+            details::store_le(buffer + 20, parity_shard_count , 4);
+            details::store_le(buffer + 24, code_length        , 4);
+            details::store_le(buffer + 28, chunk_size         , 4);
+            details::store_le(buffer + 32, file_size          , 8);
+            details::store_le(buffer + 56, crc32c::compute(buffer, 56), 4);
+         }
+
+         inline bool read(const unsigned char buffer[size])
+         {
+            if (0 != std::memcmp(buffer, "SCHIFRA\x53", 8))
+               return false;
+            else if (details::load_le(buffer + 56, 4) != crc32c::compute(buffer, 56))
+               return false;
+
+            version            = static_cast<unsigned int>(details::load_le(buffer +  8, 2));
+            shard_index        = static_cast<unsigned int>(details::load_le(buffer + 12, 4));
+            data_shard_count   = static_cast<unsigned int>(details::load_le(buffer + 16, 4));
+            parity_shard_count = static_cast<unsigned int>(details::load_le(buffer + 20, 4));
+            code_length        = static_cast<unsigned int>(details::load_le(buffer + 24, 4));
+            chunk_size         = static_cast<unsigned int>(details::load_le(buffer + 28, 4));
+            file_size          = static_cast<std::size_t >(details::load_le(buffer + 32, 8));
+
+            return (version_1 == version) &&
+                   (size == details::load_le(buffer + 10, 2)) &&
+                   (data_shard_count > 0) && (chunk_size > 0) && (file_size > 0) &&
+                   ((data_shard_count + parity_shard_count) <= code_length) &&
+                   (shard_index < (data_shard_count + parity_shard_count));
+         }
+
+         unsigned int version;
+         unsigned int shard_index;
+         unsigned int data_shard_count;
+         unsigned int parity_shard_count;
+         unsigned int code_length;
+         unsigned int chunk_size;
+         std::size_t  file_size;
+      };
+
+      /*
+         One stripe in flight through the shard codecs, holding a chunk
+         of every shard, each followed by room for its checksum.
+      */
+      struct shard_stripe
+      {
+         shard_stripe()
+         : index(0),
+           rows(0),
+           stride(0)
+         {}
+
+         inline void resize(const std::size_t shard_count, const std::size_t chunk_size)
+         {
+            stride = chunk_size + 4;
+            buffer.resize(shard_count * stride);
+            valid.resize(shard_count);
+         }
+
+         inline unsigned char* chunk(const std::size_t shard)
+         {
+            return &buffer[shard * stride];
+         }
+
+         inline void seal(const std::size_t shard)
+         {
+            details::store_le(chunk(shard) + rows, crc32c::compute(chunk(shard), rows), 4);
+         }
+
+         inline bool verify(const std::size_t shard)
+         {
+            return (details::load_le(chunk(shard) + rows, 4) == crc32c::compute(chunk(shard), rows));
+         }
+
+         std::size_t index;
+         std::size_t rows;
+         std::size_t stride;
+         std::vector<unsigned char> buffer;
+         std::vector<char> valid;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,347 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_SHARD_FILE_DECODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_SHARD_FILE_DECODER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/bind/bind.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "schifra_bounded_queue.hpp"
+#include "schifra_erasure_channel.hpp"
+#include "schifra_reed_solomon_shard.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Restores a file from the shard files written by shard_file_encoder,
+         given in shard index order. Shard files that are missing, or not
+         of the set, are left out, and chunks failing their checksum are
+         treated as lost for their stripe. A stripe is restored as long as
+         no more than fec length of its chunks are lost. Each shard file
+         is read by a thread of its own.
+      */
+      template <std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class shard_file_decoder
+      {
+      public:
+
+         typedef erasure_code_decoder<code_length,fec_length> decoder_type;
+
+         enum { stripe_pool_size = 3 };
+
+         shard_file_decoder(const decoder_type& decoder,
+                            const std::vector<std::string>& shard_file_names,
+                            const std::string& output_file_name)
+         : success_(false),
+           failure_count_(0),
+           lost_chunk_count_(0),
+           shard_count_(shard_file_names.size())
+         {
+            if (!decoder.supports_interleaved())
+            {
+               std::cout << "reed_solomon::shard_file_decoder() - Error: decoder does not support interleaved decoding." << std::endl;
+               return;
+            }
+
+            if (!open_shards(shard_file_names))
+            {
+               std::cout << "reed_solomon::shard_file_decoder() - Error: no valid shard set found." << std::endl;
+               return;
+            }
+
+            std::ofstream out_stream(output_file_name.c_str(),std::ios::binary);
+
+            if (!out_stream)
+            {
+               std::cout << "reed_solomon::shard_file_decoder() - Error: output file could not be created." << std::endl;
+               return;
+            }
+
+            boost::thread_group readers;
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               if (present_[j])
+               {
+                  readers.create_thread(boost::bind(&shard_file_decoder::read_shard,this,j));
+               }
+            }
+
+            const bool stripes_written = decode_stripes(decoder, out_stream);
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               read_queue_list_[j].close();
+            }
+
+            readers.join_all();
+
+            out_stream.close();
+
+            if (!stripes_written || out_stream.fail())
+            {
+               std::cout << "reed_solomon::shard_file_decoder() - Error: output file could not be written." << std::endl;
+               return;
+            }
+
+            if (failure_count_ > 0)
+            {
+               std::cout << "reed_solomon::shard_file_decoder() - Error: "
+                         << failure_count_ << " stripe(s) had too many lost chunks to be restored." << std::endl;
+            }
+
+            success_ = true;
+         }
+
+         /* True when the whole file was restored. */
+         inline bool success() const
+         {
+            return success_ && (0 == failure_count_);
+         }
+
+         /* Stripes that could not be restored, their lost data is output as zeros. */
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+         /* Chunks found missing or damaged across all stripes. */
+         inline std::size_t lost_chunk_count() const
+         {
+            return lost_chunk_count_;
+         }
+
+      private:
+
+         shard_file_decoder(const shard_file_decoder&);
+         shard_file_decoder& operator=(const shard_file_decoder&);
+
+         inline bool open_shards(const std::vector<std::string>& shard_file_names)
+         {
+            present_.assign(shard_count_,0);
+
+            bool header_found = false;
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               shard_stream_list_.push_back(new std::ifstream(shard_file_names[j].c_str(),std::ios::binary));
+               read_queue_list_  .push_back(new utils::bounded_queue<shard_stripe*>(stripe_pool_size));
+               done_queue_list_  .push_back(new utils::bounded_queue<shard_stripe*>(stripe_pool_size));
+
+               unsigned char header_buffer[shard_header::size];
+               shard_header  header;
+
+               shard_stream_list_[j].read(reinterpret_cast<char*>(header_buffer), shard_header::size);
+
+               if (!shard_stream_list_[j] || !header.read(header_buffer) || (j != header.shard_index))
+                  continue;
+               else if (!header_found)
+               {
+                  header_       = header;
+                  header_found = true;
+               }
+               else if (!header_.same_set(header))
+                  continue;
+
+               present_[j] = 1;
+            }
+
+            return header_found &&
+                   (code_length == header_.code_length) &&
+                   (fec_length  == header_.parity_shard_count) &&
+                   (shard_count_ == header_.shard_count());
+         }
+
+         inline bool decode_stripes(const decoder_type& decoder, std::ofstream& out_stream)
+         {
+            const std::size_t data_shard_count = header_.data_shard_count;
+            const std::size_t padding_length   = data_length - data_shard_count;
+            const std::size_t stripe_count     = header_.stripe_count();
+
+            std::vector<unsigned char> zero_column(header_.chunk_size,0x00);
+
+            stripe_list_.resize(std::min<std::size_t>(stripe_pool_size, stripe_count));
+
+            for (std::size_t s = 0; s < stripe_list_.size(); ++s)
+            {
+               stripe_list_[s].resize(shard_count_,header_.chunk_size);
+               request_stripe(stripe_list_[s], s);
+            }
+
+            unsigned char* column[code_length];
+
+            for (std::size_t i = 0; i < padding_length; ++i)
+            {
+               column[i] = &zero_column[0];
+            }
+
+            std::size_t remaining = header_.file_size;
+
+            for (std::size_t s = 0; s < stripe_count; ++s)
+            {
+               shard_stripe& stripe = stripe_list_[s % stripe_list_.size()];
+
+               erasure_locations_t erasure_list;
+               std::size_t lost_data_chunks = 0;
+
+               for (std::size_t j = 0; j < shard_count_; ++j)
+               {
+                  if (present_[j])
+                  {
+                     shard_stripe* done = 0;
+                     done_queue_list_[j].pop(done);
+                  }
+
+                  const std::size_t position = (j < data_shard_count) ?
+                                               (padding_length + j) :
+                                               (data_length + j - data_shard_count);
+
+                  column[position] = stripe.chunk(j);
+
+                  if (!stripe.valid[j])
+                  {
+                     std::memset(stripe.chunk(j), 0x00, stripe.rows);
+
+                     erasure_list.push_back(position);
+
+                     if (j < data_shard_count)
+                     {
+                        ++lost_data_chunks;
+                     }
+                  }
+               }
+
+               lost_chunk_count_ += erasure_list.size();
+
+               if (lost_data_chunks > 0)
+               {
+                  if (erasure_list.size() > fec_length)
+                     ++failure_count_;
+                  else
+                  {
+                     /*
+                        The erasure decoder takes exactly fec length
+                        erasures, any short of that are made up with
+                        intact parity chunks, which are not needed.
+                     */
+                     for (std::size_t j = data_shard_count; (j < shard_count_) && (erasure_list.size() < fec_length); ++j)
+                     {
+                        if (stripe.valid[j])
+                        {
+                           erasure_list.push_back(data_length + j - data_shard_count);
+                        }
+                     }
+
+                     if (!decoder.decode_interleaved(column,stripe.rows,erasure_list))
+                     {
+                        ++failure_count_;
+                     }
+                  }
+               }
+
+               for (std::size_t i = 0; (i < data_shard_count) && (remaining > 0); ++i)
+               {
+                  const std::size_t amount = std::min(stripe.rows, remaining);
+
+                  out_stream.write(reinterpret_cast<const char*>(stripe.chunk(i)), static_cast<std::streamsize>(amount));
+
+                  remaining -= amount;
+               }
+
+               if (!out_stream)
+                  return false;
+
+               if ((s + stripe_list_.size()) < stripe_count)
+               {
+                  request_stripe(stripe, s + stripe_list_.size());
+               }
+            }
+
+            return true;
+         }
+
+         inline void request_stripe(shard_stripe& stripe, const std::size_t index)
+         {
+            stripe.index = index;
+            stripe.rows  = header_.stripe_rows(index);
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               stripe.valid[j] = 0;
+
+               if (present_[j])
+               {
+                  read_queue_list_[j].push(&stripe);
+               }
+            }
+         }
+
+         void read_shard(const std::size_t shard)
+         {
+            shard_stripe* stripe = 0;
+
+            while (read_queue_list_[shard].pop(stripe))
+            {
+               shard_stream_list_[shard].read(reinterpret_cast<char*>(stripe->chunk(shard)),
+                                              static_cast<std::streamsize>(stripe->rows + 4));
+
+               stripe->valid[shard] = (shard_stream_list_[shard] && stripe->verify(shard)) ? 1 : 0;
+
+               done_queue_list_[shard].push(stripe);
+            }
+         }
+
+         bool success_;
+         std::size_t failure_count_;
+         std::size_t lost_chunk_count_;
+         const std::size_t shard_count_;
+         shard_header header_;
+         std::vector<char> present_;
+         std::vector<shard_stripe> stripe_list_;
+         boost::ptr_vector<std::ifstream> shard_stream_list_;
+         boost::ptr_vector<utils::bounded_queue<shard_stripe*> > read_queue_list_;
+         boost::ptr_vector<utils::bounded_queue<shard_stripe*> > done_queue_list_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,304 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_SHARD_FILE_ENCODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_SHARD_FILE_ENCODER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/bind/bind.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "schifra_bounded_queue.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_shard.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Splits a file into data and parity shard files, see shard_header.
+         The number of shard file names given, less the fec length of
+         the code, is the number of data shards, which may be up to the
+         data length of the code. Stripes are read and encoded by the
+         calling thread while each shard file is written by a thread of
+         its own, so the shards are written concurrently and the devices
+         holding them stream in parallel.
+      */
+      template <std::size_t chunk_size,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class shard_file_encoder
+      {
+      public:
+
+         typedef encoder<code_length,fec_length> encoder_type;
+
+         enum { stripe_pool_size = 3 };
+
+         shard_file_encoder(const encoder_type& encoder,
+                            const std::string& input_file_name,
+                            const std::vector<std::string>& shard_file_names)
+         : success_(false),
+           shard_count_(shard_file_names.size()),
+           data_shard_count_((shard_count_ > fec_length) ? (shard_count_ - fec_length) : 0),
+           write_failed_(shard_count_,0)
+         {
+            if ((0 == data_shard_count_) || (data_shard_count_ > data_length))
+            {
+               std::cout << "reed_solomon::shard_file_encoder() - Error: between "
+                         << (fec_length + 1) << " and " << code_length << " shard files are required." << std::endl;
+               return;
+            }
+            else if (!encoder.supports_interleaved())
+            {
+               std::cout << "reed_solomon::shard_file_encoder() - Error: encoder does not support interleaved encoding." << std::endl;
+               return;
+            }
+
+            const std::size_t file_size = schifra::fileio::file_size(input_file_name);
+
+            if (0 == file_size)
+            {
+               std::cout << "reed_solomon::shard_file_encoder() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            std::ifstream in_stream(input_file_name.c_str(),std::ios::binary);
+
+            if (!in_stream)
+            {
+               std::cout << "reed_solomon::shard_file_encoder() - Error: input file could not be opened." << std::endl;
+               return;
+            }
+
+            shard_header header;
+
+            header.data_shard_count   = static_cast<unsigned int>(data_shard_count_);
+            header.parity_shard_count = static_cast<unsigned int>(fec_length);
+            header.code_length        = static_cast<unsigned int>(code_length);
+            header.chunk_size         = static_cast<unsigned int>(chunk_size);
+            header.file_size          = file_size;
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               shard_stream_list_.push_back(new std::ofstream(shard_file_names[j].c_str(),std::ios::binary));
+
+               unsigned char header_buffer[shard_header::size];
+
+               header.shard_index = static_cast<unsigned int>(j);
+               header.write(header_buffer);
+
+               shard_stream_list_[j].write(reinterpret_cast<const char*>(header_buffer), shard_header::size);
+
+               if (!shard_stream_list_[j])
+               {
+                  std::cout << "reed_solomon::shard_file_encoder() - Error: shard file "
+                            << shard_file_names[j] << " could not be created." << std::endl;
+                  return;
+               }
+
+               write_queue_list_.push_back(new utils::bounded_queue<shard_stripe*>(stripe_pool_size));
+               done_queue_list_ .push_back(new utils::bounded_queue<shard_stripe*>(stripe_pool_size));
+            }
+
+            boost::thread_group writers;
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               writers.create_thread(boost::bind(&shard_file_encoder::write_shard,this,j));
+            }
+
+            const bool stripes_encoded = encode_stripes(encoder, in_stream, header);
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               write_queue_list_[j].close();
+            }
+
+            writers.join_all();
+
+            if (!stripes_encoded)
+               return;
+
+            for (std::size_t j = 0; j < shard_count_; ++j)
+            {
+               if (write_failed_[j])
+               {
+                  std::cout << "reed_solomon::shard_file_encoder() - Error: shard file "
+                            << shard_file_names[j] << " could not be written." << std::endl;
+                  return;
+               }
+            }
+
+            success_ = true;
+         }
+
+         inline bool success() const
+         {
+            return success_;
+         }
+
+      private:
+
+         shard_file_encoder(const shard_file_encoder&);
+         shard_file_encoder& operator=(const shard_file_encoder&);
+
+         inline bool encode_stripes(const encoder_type& encoder, std::ifstream& in_stream, const shard_header& header)
+         {
+            std::vector<unsigned char> zero_column(chunk_size,0x00);
+
+            stripe_list_.resize(stripe_pool_size);
+
+            for (std::size_t i = 0; i < stripe_list_.size(); ++i)
+            {
+               stripe_list_[i].resize(shard_count_,chunk_size);
+            }
+
+            /*
+               The code is shortened by taking its leading data columns
+               to be zero, the data shards then follow, and the parity
+               shards are the parity columns.
+            */
+            const std::size_t padding_length = data_length - data_shard_count_;
+
+            unsigned char* column[code_length];
+
+            for (std::size_t i = 0; i < padding_length; ++i)
+            {
+               column[i] = &zero_column[0];
+            }
+
+            std::size_t remaining = header.file_size;
+
+            for (std::size_t s = 0; s < header.stripe_count(); ++s)
+            {
+               shard_stripe* stripe = &stripe_list_[s % stripe_list_.size()];
+
+               if (s >= stripe_list_.size())
+               {
+                  /* Wait for every writer to be done with the stripe. */
+                  for (std::size_t j = 0; j < shard_count_; ++j)
+                  {
+                     shard_stripe* done = 0;
+                     done_queue_list_[j].pop(done);
+                  }
+               }
+
+               stripe->index = s;
+               stripe->rows  = header.stripe_rows(s);
+
+               for (std::size_t i = 0; i < data_shard_count_; ++i)
+               {
+                  unsigned char*    chunk  = stripe->chunk(i);
+                  const std::size_t amount = std::min(stripe->rows, remaining);
+
+                  in_stream.read(reinterpret_cast<char*>(chunk),static_cast<std::streamsize>(amount));
+
+                  if (static_cast<std::size_t>(in_stream.gcount()) != amount)
+                  {
+                     std::cout << "reed_solomon::shard_file_encoder() - Error: input file could not be read." << std::endl;
+                     return false;
+                  }
+
+                  std::memset(chunk + amount, 0x00, stripe->rows - amount);
+
+                  remaining -= amount;
+
+                  column[padding_length + i] = chunk;
+               }
+
+               for (std::size_t i = 0; i < fec_length; ++i)
+               {
+                  column[data_length + i] = stripe->chunk(data_shard_count_ + i);
+               }
+
+               if (!encoder.encode_interleaved(column,stripe->rows))
+               {
+                  std::cout << "reed_solomon::shard_file_encoder() - Error: stripe could not be encoded." << std::endl;
+                  return false;
+               }
+
+               for (std::size_t j = 0; j < shard_count_; ++j)
+               {
+                  stripe->seal(j);
+                  write_queue_list_[j].push(stripe);
+               }
+            }
+
+            return true;
+         }
+
+         void write_shard(const std::size_t shard)
+         {
+            shard_stripe* stripe = 0;
+
+            while (write_queue_list_[shard].pop(stripe))
+            {
+               if (!write_failed_[shard])
+               {
+                  shard_stream_list_[shard].write(reinterpret_cast<const char*>(stripe->chunk(shard)),
+                                                  static_cast<std::streamsize>(stripe->rows + 4));
+
+                  write_failed_[shard] = !shard_stream_list_[shard] ? 1 : 0;
+               }
+
+               done_queue_list_[shard].push(stripe);
+            }
+
+            shard_stream_list_[shard].close();
+
+            if (shard_stream_list_[shard].fail())
+            {
+               write_failed_[shard] = 1;
+            }
+         }
+
+         bool success_;
+         const std::size_t shard_count_;
+         const std::size_t data_shard_count_;
+         std::vector<char> write_failed_;
+         std::vector<shard_stripe> stripe_list_;
+         boost::ptr_vector<std::ofstream> shard_stream_list_;
+         boost::ptr_vector<utils::bounded_queue<shard_stripe*> > write_queue_list_;
+         boost::ptr_vector<utils::bounded_queue<shard_stripe*> > done_queue_list_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
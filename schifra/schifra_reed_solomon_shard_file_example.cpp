@@ -0,0 +1,119 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+/*
+   Description: This example will demonstrate how to stripe a file over a
+                set of data and parity shard files, as could be placed on
+                separate disks, and then restore the file from them after
+                losing as many of the shards as there are parity shards.
+                Each shard file is written and read by a thread of its own.
+*/
+
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "schifra_galois_field.hpp"
+#include "schifra_galois_field_polynomial.hpp"
+#include "schifra_sequential_root_generator_polynomial_creator.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_erasure_channel.hpp"
+#include "schifra_reed_solomon_shard_file_encoder.hpp"
+#include "schifra_reed_solomon_shard_file_decoder.hpp"
+
+
+int main()
+{
+   const std::size_t field_descriptor    =       8;
+   const std::size_t gen_poly_index      =     120;
+   const std::size_t code_length         =     255;
+   const std::size_t fec_length          =       4;
+   const std::size_t data_shard_count    =      10;
+   const std::size_t chunk_size          = 1048576;
+   const std::string input_file_name     = "input.dat";
+   const std::string output_file_name    = "output.decoded";
+
+   typedef schifra::reed_solomon::encoder<code_length,fec_length> encoder_t;
+   typedef schifra::reed_solomon::erasure_code_decoder<code_length,fec_length> decoder_t;
+   typedef schifra::reed_solomon::shard_file_encoder<chunk_size,code_length,fec_length> file_encoder_t;
+   typedef schifra::reed_solomon::shard_file_decoder<code_length,fec_length> file_decoder_t;
+
+   const schifra::galois::field field(field_descriptor,
+                                      schifra::galois::primitive_polynomial_size06,
+                                      schifra::galois::primitive_polynomial06);
+
+   schifra::galois::field_polynomial generator_polynomial(field);
+
+   if (
+        !schifra::make_sequential_root_generator_polynomial(field,
+                                                            gen_poly_index,
+                                                            fec_length,
+                                                            generator_polynomial)
+      )
+   {
+      std::cout << "Error - Failed to create sequential root generator!" << std::endl;
+      return 1;
+   }
+
+   const encoder_t rs_encoder(field,generator_polynomial);
+   const decoder_t rs_decoder(field,gen_poly_index);
+
+   /* In practice each shard would be placed on a different device. */
+   std::vector<std::string> shard_file_name_list;
+
+   for (std::size_t i = 0; i < (data_shard_count + fec_length); ++i)
+   {
+      std::ostringstream shard_file_name;
+      shard_file_name << "input.schifra_shard" << i;
+      shard_file_name_list.push_back(shard_file_name.str());
+   }
+
+   const file_encoder_t file_encoder(rs_encoder, input_file_name, shard_file_name_list);
+
+   if (!file_encoder.success())
+   {
+      std::cout << "Error - Shard encoding failed!" << std::endl;
+      return 1;
+   }
+
+   /* Lose as many shards as there are parity shards. */
+   for (std::size_t i = 0; i < fec_length; ++i)
+   {
+      std::remove(shard_file_name_list[i * 3].c_str());
+   }
+
+   const file_decoder_t file_decoder(rs_decoder, shard_file_name_list, output_file_name);
+
+   if (!file_decoder.success())
+   {
+      std::cout << "Error - Shard decoding failed!" << std::endl;
+      return 1;
+   }
+
+   std::cout << "Lost chunks: " << file_decoder.lost_chunk_count() << std::endl;
+
+   return 0;
+}
@@ -27,5 +27,6 @@ int main()
 {
    schifra::reed_solomon::speed_test_00();
    schifra::reed_solomon::speed_test_01();
+   schifra::reed_solomon::speed_test_02();
    return 0;
 }
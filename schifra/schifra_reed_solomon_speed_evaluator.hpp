@@ -179,6 +179,7 @@ namespace schifra
 
             RSEncoder rs_encoder(field,generator_polynomial);
             RSDecoder rs_decoder(field,gen_poly_index);
+            typename RSDecoder::workspace_type workspace;
 
             std::vector< block<code_length,fec_length> > original_block;
 
@@ -212,7 +213,7 @@ namespace schifra
             {
                for (std::size_t i = 0; i < rs_block.size(); ++i)
                {
-                  if (!rs_decoder.decode(rs_block[i]))
+                  if (!rs_decoder.decode(rs_block[i],workspace))
                   {
                      std::cout << "Decoding Failure!" << std::endl;
                      block_failures++;
@@ -280,6 +281,7 @@ namespace schifra
 
             RSEncoder rs_encoder(field,generator_polynomial);
             RSDecoder rs_decoder(field,gen_poly_index);
+            typename RSDecoder::workspace_type workspace;
 
             std::vector< block<code_length,fec_length> > original_block;
 
@@ -323,7 +325,7 @@ namespace schifra
             {
                for (std::size_t i = 0; i < rs_block.size(); ++i)
                {
-                  if (!rs_decoder.decode(rs_block[i],erasure_list[i]))
+                  if (!rs_decoder.decode(rs_block[i],erasure_list[i],workspace))
                   {
                      std::cout << "Decoding Failure!" << std::endl;
                      block_failures++;
@@ -364,6 +366,83 @@ namespace schifra
 
       };
 
+      template <std::size_t field_descriptor,
+                std::size_t gen_poly_index,
+                std::size_t code_length,
+                std::size_t fec_length,
+                typename RSEncoder = encoder<code_length,fec_length>,
+                std::size_t data_length = code_length - fec_length>
+      struct encoder_speed_test
+      {
+      public:
+
+         encoder_speed_test(const std::size_t prim_poly_size, const unsigned int prim_poly[])
+         {
+            galois::field field(field_descriptor,prim_poly_size,prim_poly);
+            galois::field_polynomial generator_polynomial(field);
+
+            if (
+                 !make_sequential_root_generator_polynomial(field,
+                                                            gen_poly_index,
+                                                            fec_length,
+                                                            generator_polynomial)
+               )
+            {
+               return;
+            }
+
+            RSEncoder rs_encoder(field,generator_polynomial);
+
+            std::vector< block<code_length,fec_length> > rs_block;
+
+            create_messages<code_length,fec_length>(rs_encoder,rs_block);
+
+            const std::size_t max_iterations = 10000;
+            std::size_t blocks_encoded       =     0;
+            std::size_t block_failures       =     0;
+
+            schifra::utils::timer timer;
+            timer.start();
+
+            for (std::size_t j = 0; j < max_iterations; ++j)
+            {
+               for (std::size_t i = 0; i < rs_block.size(); ++i)
+               {
+                  if (!rs_encoder.encode(rs_block[i]))
+                  {
+                     std::cout << "Encoding Failure!" << std::endl;
+                     block_failures++;
+                  }
+                  else
+                     blocks_encoded++;
+               }
+            }
+
+            timer.stop();
+
+            double time = timer.time();
+            double mbps = ((max_iterations * rs_block.size() * data_length) * 8.0) / (1048576.0 * time);
+
+            print_codec_properties();
+
+            if (block_failures == 0)
+               printf("Blocks encoded: %8d  Time:%8.3fsec  Rate:%8.3fMbps\n",
+                      static_cast<int>(blocks_encoded),
+                      time,
+                      mbps);
+            else
+               std::cout << "Blocks encoded: " << blocks_encoded << "\tEncode Failures: " << block_failures <<"\tTime: " << time <<"sec\tRate: " << mbps << "Mbps" << std::endl;
+         }
+
+         void print_codec_properties()
+         {
+            printf("[Encoder Test] Codec: RS(%03d,%03d,%03d) ",
+                   static_cast<int>(code_length),
+                   static_cast<int>(data_length),
+                   static_cast<int>(fec_length));
+         }
+      };
+
       void speed_test_00()
       {
          all_errors_decoder_speed_test<8,120,255,  2>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
@@ -404,6 +483,17 @@ namespace schifra
          all_erasures_decoder_speed_test<8,120,255,128>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
       }
 
+      void speed_test_02()
+      {
+         encoder_speed_test<8,120,255,  2>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
+         encoder_speed_test<8,120,255,  4>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
+         encoder_speed_test<8,120,255,  8>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
+         encoder_speed_test<8,120,255, 16>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
+         encoder_speed_test<8,120,255, 32>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
+         encoder_speed_test<8,120,255, 64>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
+         encoder_speed_test<8,120,255,128>(galois::primitive_polynomial_size06,galois::primitive_polynomial06);
+      }
+
    } // namespace reed_solomon
 
 } // namespace schifra
@@ -0,0 +1,311 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_STREAM_CODEC_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_STREAM_CODEC_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Push/pull front end to the part processors of the file codecs,
+         for data whose size is not known up front, such as a pipe. Bytes
+         are pushed in with write() and the processed bytes pulled out
+         with read(), in chunks of any size. Only one part is buffered on
+         either side, so write() accepts no more once the input part is
+         full and the output of the previous part has not yet been read.
+         finish() marks the end of the input, after which read() also
+         yields the processed tail part. The bytes produced are exactly
+         those of the file codec with the same part size.
+      */
+      template <typename Processor>
+      class stream_codec
+      {
+      public:
+
+         stream_codec(const Processor& processor,
+                      const std::size_t input_part_size,
+                      const std::size_t output_part_size)
+         : processor_(processor),
+           output_offset_(0),
+           index_(0),
+           failure_count_(0),
+           finished_(false),
+           failed_(false)
+         {
+            part_.input .resize(input_part_size );
+            part_.output.resize(output_part_size);
+         }
+
+         /*
+            Buffer up to length bytes of input, returning how many were
+            taken. Fewer than length are taken only when the output has
+            to be read first, or once the codec has finished or failed.
+         */
+         inline std::size_t write(const char* data, const std::size_t length)
+         {
+            std::size_t consumed = 0;
+
+            while ((consumed < length) && !finished_ && !failed_)
+            {
+               if (part_.length == part_.input.size())
+               {
+                  if (!process_part())
+                     break;
+               }
+
+               const std::size_t amount = std::min(length - consumed, part_.input.size() - part_.length);
+
+               std::copy(data + consumed, data + consumed + amount, part_.input.begin() + part_.length);
+
+               part_.length += amount;
+               consumed     += amount;
+            }
+
+            return consumed;
+         }
+
+         /*
+            Copy up to length bytes of output into data, returning how
+            many were copied. Returns zero when no further output is
+            available until more input has been written or the stream
+            finished.
+         */
+         inline std::size_t read(char* data, const std::size_t length)
+         {
+            std::size_t produced = 0;
+
+            while (produced < length)
+            {
+               if (output_offset_ == part_.output_length)
+               {
+                  const bool ready = (part_.length == part_.input.size()) ||
+                                     (finished_ && (part_.length > 0));
+
+                  if (!ready || !process_part())
+                     break;
+               }
+
+               const std::size_t amount = std::min(length - produced, part_.output_length - output_offset_);
+
+               std::copy(part_.output.begin() + output_offset_,
+                         part_.output.begin() + output_offset_ + amount,
+                         data + produced);
+
+               output_offset_ += amount;
+               produced       += amount;
+            }
+
+            return produced;
+         }
+
+         /* Mark the end of the input, the tail part is processed as it is read. */
+         inline void finish()
+         {
+            finished_ = true;
+         }
+
+         /* True once finished and all of the output has been read. */
+         inline bool done() const
+         {
+            return (finished_ || failed_) &&
+                   (0 == part_.length)    &&
+                   (output_offset_ == part_.output_length);
+         }
+
+         /* True when a part could not be processed, see the processors. */
+         inline bool failed() const
+         {
+            return failed_;
+         }
+
+         /* Total of the failures reported by the processor across all parts. */
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+      private:
+
+         stream_codec(const stream_codec&);
+         stream_codec& operator=(const stream_codec&);
+
+         inline bool process_part()
+         {
+            if (failed_ || (output_offset_ != part_.output_length))
+               return false;
+
+            part_.index         = index_++;
+            part_.output_length = 0;
+            part_.failures      = 0;
+            part_.valid         = processor_.process_part(part_);
+
+            output_offset_ = 0;
+            part_.length   = 0;
+
+            if (!part_.valid)
+            {
+               part_.output_length = 0;
+               failed_ = true;
+               return false;
+            }
+
+            failure_count_ += part_.failures;
+
+            return true;
+         }
+
+         const Processor processor_;
+         file_part part_;
+         std::size_t output_offset_;
+         std::size_t index_;
+         std::size_t failure_count_;
+         bool finished_;
+         bool failed_;
+      };
+
+      /*
+         Streaming counterparts of file_encoder and file_decoder, reading
+         and writing the same format given the same part_size_bytes.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class stream_encoder : public stream_codec<file_part_encoder<code_length,fec_length,data_length> >
+      {
+      public:
+
+         typedef encoder<code_length,fec_length,data_length> encoder_type;
+         typedef file_part_encoder<code_length,fec_length,data_length> processor_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * data_length       };
+         enum { part_output_size = part_rows * code_length       };
+
+         explicit stream_encoder(const encoder_type& rs_encoder)
+         : stream_codec<processor_type>(processor_type(rs_encoder),
+                                        part_input_size,
+                                        part_output_size)
+         {}
+      };
+
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class stream_decoder : public stream_codec<file_part_decoder<code_length,fec_length,data_length> >
+      {
+      public:
+
+         typedef decoder<code_length,fec_length,data_length> decoder_type;
+         typedef file_part_decoder<code_length,fec_length,data_length> processor_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * code_length       };
+         enum { part_output_size = part_rows * data_length       };
+
+         explicit stream_decoder(const decoder_type& rs_decoder)
+         : stream_codec<processor_type>(processor_type(rs_decoder),
+                                        part_input_size,
+                                        part_output_size)
+         {}
+      };
+
+      /*
+         Run a stream codec from in_stream to out_stream until the end of
+         in_stream, through a buffer of buffer_size bytes. Returns false
+         if in_stream could not be read, the codec failed or out_stream
+         could not be written.
+      */
+      template <typename Processor>
+      inline bool process_stream(stream_codec<Processor>& codec,
+                                 std::istream& in_stream,
+                                 std::ostream& out_stream,
+                                 const std::size_t buffer_size = 65536)
+      {
+         std::vector<char> buffer(buffer_size);
+         std::vector<char> output(buffer_size);
+
+         std::size_t input_length = 0;
+         std::size_t input_offset = 0;
+
+         while (!codec.done())
+         {
+            if ((input_offset == input_length) && in_stream)
+            {
+               in_stream.read(&buffer[0],static_cast<std::streamsize>(buffer.size()));
+
+               input_length = static_cast<std::size_t>(in_stream.gcount());
+               input_offset = 0;
+
+               if (0 == input_length)
+               {
+                  codec.finish();
+               }
+            }
+
+            /* Unlike the end of the input, a read error must not pass for a complete stream. */
+            if (in_stream.bad())
+               return false;
+
+            input_offset += codec.write(&buffer[input_offset],input_length - input_offset);
+
+            if ((input_offset == input_length) && !in_stream)
+            {
+               codec.finish();
+            }
+
+            std::size_t output_length = 0;
+
+            while ((output_length = codec.read(&output[0],output.size())) > 0)
+            {
+               out_stream.write(&output[0],static_cast<std::streamsize>(output_length));
+
+               if (!out_stream)
+                  return false;
+            }
+         }
+
+         return !codec.failed();
+      }
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,118 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+/*
+   Description: This example will demonstrate how to use the streaming
+                Reed-Solomon codec as a filter in a shell pipeline, reading
+                from stdin and writing to stdout without knowing the size
+                of the data up front, for example:
+
+                   tar cf - dir | ./schifra_reed_solomon_stream_codec_example > dir.tar.schifra
+                   ./schifra_reed_solomon_stream_codec_example -d < dir.tar.schifra | tar xf -
+
+                The encoded stream is the same as that of the file_encoder
+                with the same part size.
+*/
+
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+#include "schifra_galois_field.hpp"
+#include "schifra_sequential_root_generator_polynomial_creator.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_stream_codec.hpp"
+
+
+int main(int argc, char* argv[])
+{
+   const std::size_t field_descriptor    =       8;
+   const std::size_t gen_poly_index      =     120;
+   const std::size_t gen_poly_root_count =      32;
+   const std::size_t code_length         =     255;
+   const std::size_t fec_length          =      32;
+   const std::size_t part_size_bytes     = 1048576;
+
+   typedef schifra::reed_solomon::encoder<code_length,fec_length> encoder_t;
+   typedef schifra::reed_solomon::decoder<code_length,fec_length> decoder_t;
+   typedef schifra::reed_solomon::stream_encoder<part_size_bytes,code_length,fec_length> stream_encoder_t;
+   typedef schifra::reed_solomon::stream_decoder<part_size_bytes,code_length,fec_length> stream_decoder_t;
+
+   const bool decode = (argc > 1) && (0 == std::strcmp(argv[1],"-d"));
+
+   const schifra::galois::field field(field_descriptor,
+                                      schifra::galois::primitive_polynomial_size06,
+                                      schifra::galois::primitive_polynomial06);
+
+   /* stdout carries the data, all diagnostics go to stderr. */
+   std::ios::sync_with_stdio(false);
+
+   if (decode)
+   {
+      const decoder_t rs_decoder(field,gen_poly_index);
+
+      stream_decoder_t stream_decoder(rs_decoder);
+
+      if (!schifra::reed_solomon::process_stream(stream_decoder, std::cin, std::cout))
+      {
+         std::cerr << "Error - Stream decoding failed!" << std::endl;
+         return 1;
+      }
+
+      if (stream_decoder.failure_count() > 0)
+      {
+         std::cerr << "Error - " << stream_decoder.failure_count() << " codeword(s) could not be corrected!" << std::endl;
+         return 1;
+      }
+   }
+   else
+   {
+      schifra::galois::field_polynomial generator_polynomial(field);
+
+      if (
+           !schifra::make_sequential_root_generator_polynomial(field,
+                                                               gen_poly_index,
+                                                               gen_poly_root_count,
+                                                               generator_polynomial)
+         )
+      {
+         std::cerr << "Error - Failed to create sequential root generator!" << std::endl;
+         return 1;
+      }
+
+      const encoder_t rs_encoder(field,generator_polynomial);
+
+      stream_encoder_t stream_encoder(rs_encoder);
+
+      if (!schifra::reed_solomon::process_stream(stream_encoder, std::cin, std::cout))
+      {
+         std::cerr << "Error - Stream encoding failed!" << std::endl;
+         return 1;
+      }
+   }
+
+   std::cout.flush();
+
+   return 0;
+}
@@ -0,0 +1,121 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_URING_FILE_DECODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_URING_FILE_DECODER_HPP
+
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "schifra_reed_solomon_block.hpp"
+#include "schifra_reed_solomon_decoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_reed_solomon_uring_file_pipeline.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         io_uring counterpart of file_decoder, see uring_file_pipeline.
+         Codewords that cannot be corrected are written out as received
+         and counted, rather than stopping the restore. Linux only.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class uring_file_decoder
+      {
+      public:
+
+         typedef decoder<code_length,fec_length> decoder_type;
+         typedef typename decoder_type::block_type block_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * code_length       };
+         enum { part_output_size = part_rows * data_length       };
+
+         uring_file_decoder(const decoder_type& decoder,
+                            const std::string& input_file_name,
+                            const std::string& output_file_name,
+                            const std::size_t queue_depth = 4)
+         : success_(false),
+           failure_count_(0)
+         {
+            if (0 == schifra::fileio::file_size(input_file_name))
+            {
+               std::cout << "reed_solomon::uring_file_decoder() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            typedef file_part_decoder<code_length,fec_length> processor_type;
+
+            const processor_type processor(decoder);
+
+            uring_file_pipeline<processor_type> pipeline(processor,
+                                                         "reed_solomon::uring_file_decoder()",
+                                                         part_input_size,
+                                                         part_output_size,
+                                                         queue_depth);
+
+            success_       = pipeline.run(input_file_name,output_file_name);
+            failure_count_ = pipeline.failure_count();
+
+            if (failure_count_ > 0)
+            {
+               std::cout << "reed_solomon::uring_file_decoder() - Error: "
+                         << failure_count_ << " codeword(s) could not be corrected." << std::endl;
+            }
+         }
+
+         /* True when the whole file was read, decoded and fully corrected. */
+         inline bool success() const
+         {
+            return success_ && (0 == failure_count_);
+         }
+
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+      private:
+
+         uring_file_decoder(const uring_file_decoder&);
+         uring_file_decoder& operator=(const uring_file_decoder&);
+
+         bool success_;
+         std::size_t failure_count_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,106 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_URING_FILE_ENCODER_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_URING_FILE_ENCODER_HPP
+
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "schifra_reed_solomon_block.hpp"
+#include "schifra_reed_solomon_encoder.hpp"
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_reed_solomon_uring_file_pipeline.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         io_uring counterpart of file_encoder, producing byte for byte
+         the same output. Several parts are kept in flight at once, see
+         uring_file_pipeline. Linux only.
+      */
+      template <std::size_t part_size_bytes,
+                std::size_t code_length,
+                std::size_t fec_length,
+                std::size_t data_length = code_length - fec_length>
+      class uring_file_encoder
+      {
+      public:
+
+         typedef encoder<code_length,fec_length> encoder_type;
+         typedef typename encoder_type::block_type block_type;
+
+         enum { part_rows        = part_size_bytes / data_length };
+         enum { part_input_size  = part_rows * data_length       };
+         enum { part_output_size = part_rows * code_length       };
+
+         uring_file_encoder(const encoder_type& encoder,
+                            const std::string& input_file_name,
+                            const std::string& output_file_name,
+                            const std::size_t queue_depth = 4)
+         : success_(false)
+         {
+            if (0 == schifra::fileio::file_size(input_file_name))
+            {
+               std::cout << "reed_solomon::uring_file_encoder() - Error: input file has ZERO size." << std::endl;
+               return;
+            }
+
+            typedef file_part_encoder<code_length,fec_length> processor_type;
+
+            const processor_type processor(encoder);
+
+            uring_file_pipeline<processor_type> pipeline(processor,
+                                                         "reed_solomon::uring_file_encoder()",
+                                                         part_input_size,
+                                                         part_output_size,
+                                                         queue_depth);
+
+            success_ = pipeline.run(input_file_name,output_file_name);
+         }
+
+         inline bool success() const
+         {
+            return success_;
+         }
+
+      private:
+
+         uring_file_encoder(const uring_file_encoder&);
+         uring_file_encoder& operator=(const uring_file_encoder&);
+
+         bool success_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif
@@ -0,0 +1,412 @@
+/*
+(**************************************************************************)
+(*                                                                        *)
+(*                                Schifra                                 *)
+(*                Reed-Solomon Error Correcting Code Library              *)
+(*                                                                        *)
+(* Release Version 0.0.1                                                  *)
+(* http://www.schifra.com                                                 *)
+(* Copyright (c) 2000-2020 Arash Partow, All Rights Reserved.             *)
+(*                                                                        *)
+(* The Schifra Reed-Solomon error correcting code library and all its     *)
+(* components are supplied under the terms of the General Schifra License *)
+(* agreement. The contents of the Schifra Reed-Solomon error correcting   *)
+(* code library and all its components may not be copied or disclosed     *)
+(* except in accordance with the terms of that agreement.                 *)
+(*                                                                        *)
+(* URL: http://www.schifra.com/license.html                               *)
+(*                                                                        *)
+(**************************************************************************)
+*/
+
+
+#ifndef INCLUDE_SCHIFRA_REED_SOLOMON_URING_FILE_PIPELINE_HPP
+#define INCLUDE_SCHIFRA_REED_SOLOMON_URING_FILE_PIPELINE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+#include "schifra_reed_solomon_file_part_codec.hpp"
+#include "schifra_io_uring.hpp"
+#include "schifra_fileio.hpp"
+
+
+namespace schifra
+{
+
+   namespace reed_solomon
+   {
+
+      /*
+         Single threaded io_uring counterpart of file_pipeline. Each of
+         queue_depth slots cycles through reading a part, processing it
+         and writing it out at its place in the output file, with every
+         read and write going through a registered buffer. Parts are
+         processed as their reads complete, so while one part is being
+         encoded or decoded the reads and writes of the other slots are
+         in flight, keeping the device queue full.
+
+         Where io_uring is unavailable, be it off Linux or refused by the
+         kernel, the parts are instead read, processed and written one
+         at a time through streams, producing the same output.
+      */
+      template <typename Processor>
+      class uring_file_pipeline
+      {
+      public:
+
+         uring_file_pipeline(const Processor&   processor,
+                             const std::string& name,
+                             const std::size_t  input_part_size,
+                             const std::size_t  output_part_size,
+                             const std::size_t  queue_depth = 4)
+         : processor_(processor),
+           name_(name),
+           output_part_size_(output_part_size),
+           slot_list_((queue_depth > 0) ? queue_depth : 1),
+           input_fd_(-1),
+           output_fd_(-1),
+           file_size_(0),
+           next_offset_(0),
+           next_index_(0),
+           in_flight_(0),
+           failure_count_(0),
+           failed_(false)
+         {
+            for (std::size_t i = 0; i < slot_list_.size(); ++i)
+            {
+               slot_list_[i].part.input .resize(input_part_size );
+               slot_list_[i].part.output.resize(output_part_size);
+            }
+         }
+
+        ~uring_file_pipeline()
+         {
+            #if defined(__linux__)
+
+            if (input_fd_  >= 0) ::close(input_fd_ );
+            if (output_fd_ >= 0) ::close(output_fd_);
+
+            #endif
+         }
+
+         inline bool run(const std::string& input_file_name, const std::string& output_file_name)
+         {
+            #if defined(__linux__)
+
+            file_size_ = schifra::fileio::file_size(input_file_name);
+
+            if ((input_fd_ = ::open(input_file_name.c_str(), O_RDONLY)) < 0)
+            {
+               fail("input file could not be opened.");
+               return false;
+            }
+
+            /*
+               The queue is set up before the output is created, so that
+               the output is left untouched should neither path be able
+               to proceed.
+            */
+            if (!queue_.initialise(static_cast<unsigned int>(slot_list_.size())))
+            {
+               ::close(input_fd_);
+               input_fd_ = -1;
+
+               return run_serial(input_file_name,output_file_name);
+            }
+
+            if ((output_fd_ = ::open(output_file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0)
+            {
+               fail("output file could not be created.");
+               return false;
+            }
+
+            std::vector<void*>       buffer(2 * slot_list_.size());
+            std::vector<std::size_t> length(2 * slot_list_.size());
+
+            for (std::size_t i = 0; i < slot_list_.size(); ++i)
+            {
+               buffer[(2 * i)    ] = &slot_list_[i].part.input [0];
+               buffer[(2 * i) + 1] = &slot_list_[i].part.output[0];
+               length[(2 * i)    ] =  slot_list_[i].part.input .size();
+               length[(2 * i) + 1] =  slot_list_[i].part.output.size();
+            }
+
+            const bool registered = queue_.register_buffers(&buffer[0], &length[0], buffer.size());
+
+            for (std::size_t i = 0; i < slot_list_.size(); ++i)
+            {
+               slot_list_[i].input_buffer  = registered ? static_cast<int>((2 * i)    ) : -1;
+               slot_list_[i].output_buffer = registered ? static_cast<int>((2 * i) + 1) : -1;
+
+               if (!start_read(i))
+                  break;
+            }
+
+            if (!queue_.submit())
+               fail("io_uring submission failed.");
+
+            /*
+               Once a failure has occurred no further requests are made,
+               but those already in flight are still waited upon, as they
+               refer to the slot buffers.
+            */
+            while (in_flight_ > 0)
+            {
+               unsigned long long user_data = 0;
+               int result = 0;
+
+               if (!queue_.wait(user_data, result))
+               {
+                  fail("io_uring completion could not be retrieved.");
+                  return false;
+               }
+
+               --in_flight_;
+
+               if (failed_)
+                  continue;
+               else if (result <= 0)
+               {
+                  fail((result < 0) ? "i/o request failed." : "unexpected end of file.");
+                  continue;
+               }
+
+               complete(static_cast<std::size_t>(user_data), static_cast<std::size_t>(result));
+
+               if (!queue_.submit())
+                  fail("io_uring submission failed.");
+            }
+
+            return !failed_;
+
+            #else
+
+            file_size_ = schifra::fileio::file_size(input_file_name);
+
+            return run_serial(input_file_name,output_file_name);
+
+            #endif
+         }
+
+         /* Total of the failures reported by the processor across all parts. */
+         inline std::size_t failure_count() const
+         {
+            return failure_count_;
+         }
+
+      private:
+
+         struct slot_type
+         {
+            slot_type()
+            : reading(false),
+              done(0),
+              input_buffer(-1),
+              output_buffer(-1)
+            {}
+
+            file_part   part;
+            bool        reading;
+            std::size_t done;
+            int         input_buffer;
+            int         output_buffer;
+         };
+
+         uring_file_pipeline(const uring_file_pipeline&);
+         uring_file_pipeline& operator=(const uring_file_pipeline&);
+
+         inline void fail(const std::string& message)
+         {
+            if (!failed_)
+            {
+               std::cout << name_ << " - Error: " << message << std::endl;
+               failed_ = true;
+            }
+         }
+
+         inline bool run_serial(const std::string& input_file_name, const std::string& output_file_name)
+         {
+            std::ifstream in_stream(input_file_name.c_str(),std::ios::binary);
+
+            if (!in_stream)
+            {
+               fail("input file could not be opened.");
+               return false;
+            }
+
+            std::ofstream out_stream(output_file_name.c_str(),std::ios::binary);
+
+            if (!out_stream)
+            {
+               fail("output file could not be created.");
+               return false;
+            }
+
+            file_part& part = slot_list_[0].part;
+
+            while (next_offset_ < file_size_)
+            {
+               part.index         = next_index_++;
+               part.length        = std::min<std::size_t>(part.input.size(), file_size_ - next_offset_);
+               part.output_length = 0;
+               part.failures      = 0;
+               part.valid         = false;
+
+               next_offset_ += part.length;
+
+               in_stream.read(&part.input[0],static_cast<std::streamsize>(part.length));
+
+               if (static_cast<std::size_t>(in_stream.gcount()) != part.length)
+               {
+                  fail("input file could not be read.");
+                  return false;
+               }
+
+               if (!processor_.process_part(part))
+               {
+                  fail("processing of part failed.");
+                  return false;
+               }
+
+               failure_count_ += part.failures;
+
+               if (part.output_length > 0)
+               {
+                  out_stream.write(reinterpret_cast<const char*>(&part.output[0]),static_cast<std::streamsize>(part.output_length));
+               }
+
+               if (!out_stream)
+               {
+                  fail("output file could not be written.");
+                  return false;
+               }
+            }
+
+            return true;
+         }
+
+         inline bool start_read(const std::size_t s)
+         {
+            if (next_offset_ >= file_size_)
+               return false;
+
+            slot_type& slot = slot_list_[s];
+
+            slot.part.index         = next_index_++;
+            slot.part.length        = std::min<std::size_t>(slot.part.input.size(), file_size_ - next_offset_);
+            slot.part.output_length = 0;
+            slot.part.failures      = 0;
+            slot.part.valid         = false;
+            slot.reading            = true;
+            slot.done               = 0;
+
+            next_offset_ += slot.part.length;
+
+            return queue_read(s);
+         }
+
+         inline bool queue_read(const std::size_t s)
+         {
+            slot_type& slot = slot_list_[s];
+
+            const unsigned long long offset = (static_cast<unsigned long long>(slot.part.index) * slot.part.input.size()) + slot.done;
+
+            if (!queue_.queue_read(input_fd_, &slot.part.input[slot.done], slot.part.length - slot.done, offset, slot.input_buffer, s))
+            {
+               fail("io_uring read could not be queued.");
+               return false;
+            }
+
+            ++in_flight_;
+
+            return true;
+         }
+
+         inline bool queue_write(const std::size_t s)
+         {
+            slot_type& slot = slot_list_[s];
+
+            const unsigned long long offset = (static_cast<unsigned long long>(slot.part.index) * output_part_size_) + slot.done;
+
+            if (!queue_.queue_write(output_fd_, &slot.part.output[slot.done], slot.part.output_length - slot.done, offset, slot.output_buffer, s))
+            {
+               fail("io_uring write could not be queued.");
+               return false;
+            }
+
+            ++in_flight_;
+
+            return true;
+         }
+
+         /*
+            A request may complete short, in which case the remainder is
+            requested again before the slot moves on.
+         */
+         inline void complete(const std::size_t s, const std::size_t transferred)
+         {
+            slot_type& slot = slot_list_[s];
+
+            slot.done += transferred;
+
+            if (slot.reading)
+            {
+               if (slot.done < slot.part.length)
+               {
+                  queue_read(s);
+                  return;
+               }
+
+               if (!processor_.process_part(slot.part))
+               {
+                  fail("processing of part failed.");
+                  return;
+               }
+
+               failure_count_ += slot.part.failures;
+
+               slot.reading = false;
+               slot.done    = 0;
+
+               if (slot.part.output_length > 0)
+                  queue_write(s);
+               else
+                  start_read(s);
+            }
+            else if (slot.done < slot.part.output_length)
+               queue_write(s);
+            else
+               start_read(s);
+         }
+
+         const Processor& processor_;
+         const std::string name_;
+         const std::size_t output_part_size_;
+         std::vector<slot_type> slot_list_;
+         fileio::io_uring_queue queue_;
+         int input_fd_;
+         int output_fd_;
+         std::size_t file_size_;
+         std::size_t next_offset_;
+         std::size_t next_index_;
+         std::size_t in_flight_;
+         std::size_t failure_count_;
+         bool failed_;
+      };
+
+   } // namespace reed_solomon
+
+} // namespace schifra
+
+#endif